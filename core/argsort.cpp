@@ -0,0 +1,225 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @author Simon Heybrock
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+
+#include "scipp/core/argsort.h"
+#include "scipp/core/parallel.h"
+
+namespace scipp::core {
+
+namespace {
+
+constexpr scipp::index min_chunk_size = 1 << 16;
+constexpr scipp::index max_chunks = 64;
+
+auto chunk_count(const scipp::index size) {
+  return std::clamp(size / min_chunk_size, scipp::index(1), max_chunks);
+}
+
+/// Map values to unsigned integers with the same ordering.
+///
+/// Signed integers have their sign bit flipped. For floating-point values the
+/// sign bit is flipped for positive values and all bits are flipped for
+/// negative values. -0.0 is mapped to the same key as 0.0 and all NaNs are
+/// mapped to the largest key, such that they compare equal and are placed
+/// after infinity.
+template <class T> auto radix_key(const T x) {
+  if constexpr (std::is_same_v<T, bool>) {
+    return static_cast<uint8_t>(x);
+  } else if constexpr (std::is_same_v<T, time_point>) {
+    return radix_key(x.time_since_epoch());
+  } else if constexpr (std::is_integral_v<T>) {
+    using Key = std::make_unsigned_t<T>;
+    constexpr auto sign = Key(1) << (8 * sizeof(T) - 1);
+    return static_cast<Key>(static_cast<Key>(x) ^ sign);
+  } else {
+    using Key = std::conditional_t<sizeof(T) == 8, uint64_t, uint32_t>;
+    constexpr auto sign = Key(1) << (8 * sizeof(T) - 1);
+    if (std::isnan(x))
+      return ~Key(0);
+    const T canonical = x == T(0) ? T(0) : x;
+    Key bits;
+    std::memcpy(&bits, &canonical, sizeof(T));
+    return static_cast<Key>((bits & sign) ? ~bits : bits ^ sign);
+  }
+}
+
+template <class Key> struct KeyIndex {
+  Key key;
+  scipp::index index;
+};
+
+template <class Key> auto digit(const Key key, const size_t pass) {
+  return static_cast<uint8_t>(key >> (8 * pass));
+}
+
+/// Stable parallel LSD radix sort with 8-bit digits, returning the permutation.
+///
+/// Every pass counts digits in chunks of the input, the output position of
+/// every chunk and digit is given by the prefix sum over (digit, chunk), and
+/// elements are then scattered in parallel. Passes for digits that are the same
+/// for all keys are skipped, e.g., for small integers or `bool`.
+template <class Key>
+std::vector<scipp::index> radix_argsort(std::vector<KeyIndex<Key>> items) {
+  const auto size = scipp::size(items);
+  const auto nchunk = chunk_count(size);
+  const auto chunk_begin = [&](const scipp::index c) {
+    return c * size / nchunk;
+  };
+  const auto chunks = parallel::blocked_range(0, nchunk, 1);
+
+  std::vector<Key> differ(nchunk, Key(0));
+  parallel::parallel_for(chunks, [&](const auto &range) {
+    for (scipp::index c = range.begin(); c != range.end(); ++c)
+      for (auto i = chunk_begin(c); i < chunk_begin(c + 1); ++i)
+        differ[c] |= items[i].key ^ items[0].key;
+  });
+  const auto mask = std::accumulate(differ.begin(), differ.end(), Key(0),
+                                    std::bit_or<Key>{});
+
+  using Counts = std::array<scipp::index, 256>;
+  std::vector<Counts> counts(nchunk);
+  std::vector<KeyIndex<Key>> buffer(size);
+  for (size_t pass = 0; pass < sizeof(Key); ++pass) {
+    if (digit(mask, pass) == 0)
+      continue;
+    parallel::parallel_for(chunks, [&](const auto &range) {
+      for (scipp::index c = range.begin(); c != range.end(); ++c) {
+        counts[c].fill(0);
+        for (auto i = chunk_begin(c); i < chunk_begin(c + 1); ++i)
+          ++counts[c][digit(items[i].key, pass)];
+      }
+    });
+    scipp::index offset = 0;
+    for (size_t d = 0; d < 256; ++d)
+      for (auto &count : counts)
+        offset += std::exchange(count[d], offset);
+    parallel::parallel_for(chunks, [&](const auto &range) {
+      for (scipp::index c = range.begin(); c != range.end(); ++c)
+        for (auto i = chunk_begin(c); i < chunk_begin(c + 1); ++i)
+          buffer[counts[c][digit(items[i].key, pass)]++] = items[i];
+    });
+    std::swap(items, buffer);
+  }
+
+  std::vector<scipp::index> indices(size);
+  parallel::parallel_for(parallel::blocked_range(0, size),
+                         [&](const auto &range) {
+                           for (auto i = range.begin(); i != range.end(); ++i)
+                             indices[i] = items[i].index;
+                         });
+  return indices;
+}
+
+template <class T>
+std::vector<scipp::index> radix_argsort(const scipp::span<const T> values,
+                                        const SortOrder order) {
+  using Key = decltype(radix_key(std::declval<T>()));
+  std::vector<KeyIndex<Key>> items(values.size());
+  const bool descending = order == SortOrder::Descending;
+  parallel::parallel_for(
+      parallel::blocked_range(0, scipp::size(values)), [&](const auto &range) {
+        for (auto i = range.begin(); i != range.end(); ++i) {
+          const auto key = radix_key(values[i]);
+          items[i] = {descending ? static_cast<Key>(~key) : key, i};
+        }
+      });
+  return radix_argsort(std::move(items));
+}
+
+/// Stable parallel merge sort, returning the permutation.
+///
+/// Chunks are sorted independently and then merged pairwise.
+template <class T, class Compare>
+std::vector<scipp::index> merge_argsort(const scipp::span<const T> values,
+                                        const Compare &compare) {
+  const auto size = scipp::size(values);
+  const auto less = [&](const scipp::index a, const scipp::index b) {
+    return compare(values[a], values[b]);
+  };
+  std::vector<scipp::index> indices(size);
+  std::iota(indices.begin(), indices.end(), scipp::index(0));
+  const auto nchunk = chunk_count(size);
+  std::vector<scipp::index> bounds(nchunk + 1);
+  for (scipp::index c = 0; c <= nchunk; ++c)
+    bounds[c] = c * size / nchunk;
+  parallel::parallel_for(
+      parallel::blocked_range(0, nchunk, 1), [&](const auto &range) {
+        for (auto c = range.begin(); c != range.end(); ++c)
+          std::stable_sort(indices.begin() + bounds[c],
+                           indices.begin() + bounds[c + 1], less);
+      });
+  std::vector<scipp::index> buffer(size);
+  while (bounds.size() > 2) {
+    const auto npair = scipp::size(bounds) / 2;
+    parallel::parallel_for(
+        parallel::blocked_range(0, npair, 1), [&](const auto &range) {
+          for (auto p = range.begin(); p != range.end(); ++p) {
+            const auto begin = indices.begin() + bounds[2 * p];
+            const auto mid = indices.begin() + bounds[2 * p + 1];
+            const auto end =
+                indices.begin() +
+                bounds[std::min(2 * p + 2, scipp::size(bounds) - 1)];
+            std::merge(begin, mid, mid, end, buffer.begin() + bounds[2 * p],
+                       less);
+          }
+        });
+    std::vector<scipp::index> merged;
+    for (scipp::index c = 0; c < scipp::size(bounds); c += 2)
+      merged.push_back(bounds[c]);
+    if (merged.back() != size)
+      merged.push_back(size);
+    bounds = std::move(merged);
+    std::swap(indices, buffer);
+  }
+  return indices;
+}
+
+} // namespace
+
+std::vector<scipp::index> argsort(const scipp::span<const double> values,
+                                  const SortOrder order) {
+  return radix_argsort(values, order);
+}
+
+std::vector<scipp::index> argsort(const scipp::span<const float> values,
+                                  const SortOrder order) {
+  return radix_argsort(values, order);
+}
+
+std::vector<scipp::index> argsort(const scipp::span<const int64_t> values,
+                                  const SortOrder order) {
+  return radix_argsort(values, order);
+}
+
+std::vector<scipp::index> argsort(const scipp::span<const int32_t> values,
+                                  const SortOrder order) {
+  return radix_argsort(values, order);
+}
+
+std::vector<scipp::index> argsort(const scipp::span<const bool> values,
+                                  const SortOrder order) {
+  return radix_argsort(values, order);
+}
+
+std::vector<scipp::index> argsort(const scipp::span<const time_point> values,
+                                  const SortOrder order) {
+  return radix_argsort(values, order);
+}
+
+std::vector<scipp::index> argsort(const scipp::span<const std::string> values,
+                                  const SortOrder order) {
+  if (order == SortOrder::Ascending)
+    return merge_argsort(values, std::less<std::string>{});
+  return merge_argsort(values, std::greater<std::string>{});
+}
+
+} // namespace scipp::core
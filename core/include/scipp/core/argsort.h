@@ -0,0 +1,37 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @author Simon Heybrock
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "scipp-core_export.h"
+#include "scipp/common/index.h"
+#include "scipp/common/span.h"
+#include "scipp/core/flags.h"
+#include "scipp/core/time_point.h"
+
+namespace scipp::core {
+
+/// Return the permutation that stably sorts `values` in given order.
+///
+/// NaN values are placed at the end when sorting in ascending order and at the
+/// beginning when sorting in descending order.
+SCIPP_CORE_EXPORT std::vector<scipp::index>
+argsort(scipp::span<const double> values, const SortOrder order);
+SCIPP_CORE_EXPORT std::vector<scipp::index>
+argsort(scipp::span<const float> values, const SortOrder order);
+SCIPP_CORE_EXPORT std::vector<scipp::index>
+argsort(scipp::span<const int64_t> values, const SortOrder order);
+SCIPP_CORE_EXPORT std::vector<scipp::index>
+argsort(scipp::span<const int32_t> values, const SortOrder order);
+SCIPP_CORE_EXPORT std::vector<scipp::index>
+argsort(scipp::span<const bool> values, const SortOrder order);
+SCIPP_CORE_EXPORT std::vector<scipp::index>
+argsort(scipp::span<const time_point> values, const SortOrder order);
+SCIPP_CORE_EXPORT std::vector<scipp::index>
+argsort(scipp::span<const std::string> values, const SortOrder order);
+
+} // namespace scipp::core
@@ -125,6 +125,33 @@ static constexpr auto update_indices_by_grouping = overloaded{
       index = (it == groups.end()) ? -1 : (index + it->second);
     }};
 
+template <class Index, class T>
+using update_indices_by_grouping_linear_arg =
+    std::tuple<Index, T, span<const T>>;
+
+/// Grouping by integer labels given by a linear range, with `params` holding
+/// its start, step, and size. This avoids building a map of all labels.
+static constexpr auto update_indices_by_grouping_linear = overloaded{
+    element::arg_list<update_indices_by_grouping_linear_arg<int64_t, int64_t>,
+                      update_indices_by_grouping_linear_arg<int32_t, int64_t>,
+                      update_indices_by_grouping_linear_arg<int64_t, int32_t>,
+                      update_indices_by_grouping_linear_arg<int32_t, int32_t>>,
+    [](units::Unit &indices, const units::Unit &coord,
+       const units::Unit &groups) {
+      expect::equals(coord, groups);
+      expect::equals(indices, units::one);
+    },
+    [](auto &index, const auto &x, const auto &params) {
+      if (index == -1)
+        return;
+      const auto step = params[1];
+      const auto size = params[2];
+      const auto offset = x - params[0];
+      const auto i = offset / step;
+      index *= size;
+      index = (offset % step != 0 || i < 0 || i >= size) ? -1 : (index + i);
+    }};
+
 static constexpr auto update_indices_from_existing = overloaded{
     element::arg_list<std::tuple<int64_t, scipp::index, scipp::index>,
                       std::tuple<int32_t, scipp::index, scipp::index>>,
@@ -32,60 +32,98 @@ namespace histogram_detail {
 template <class Out, class Coord, class Weight, class Edge>
 using args = std::tuple<span<Out>, span<const Coord>, span<const Weight>,
                         span<const Edge>>;
+template <class Out, class Coord, class Weight, class Edge>
+using masked_args = std::tuple<span<Out>, span<const Coord>, span<const Weight>,
+                               span<const Edge>, span<const bool>>;
+
+template <template <class...> class Args>
+using types = arg_list_t<
+    Args<float, double, float, double>, Args<float, int64_t, float, double>,
+    Args<float, int32_t, float, double>, Args<double, double, double, double>,
+    Args<double, float, double, double>, Args<double, float, double, float>,
+    Args<double, double, float, double>, Args<double, int64_t, double, int64_t>,
+    Args<double, int32_t, double, int64_t>,
+    Args<double, int64_t, double, int32_t>,
+    Args<double, int32_t, double, int32_t>,
+    Args<double, time_point, double, time_point>,
+    Args<double, time_point, float, time_point>,
+    Args<float, time_point, double, time_point>,
+    Args<float, time_point, float, time_point>>;
+
+template <class Masked, class Data, class Events, class Weights, class Edges>
+void histogram(const Masked &masked, const Data &data, const Events &events,
+               const Weights &weights, const Edges &edges) {
+  zero(data);
+  // Special implementation for linear bins. Gives a 1x to 20x speedup
+  // for few and many events per histogram, respectively.
+  if (scipp::numeric::islinspace(edges)) {
+    const auto [offset, nbin, scale] = core::linear_edge_params(edges);
+    for (scipp::index i = 0; i < scipp::size(events); ++i) {
+      if (masked(i))
+        continue;
+      const auto x = events[i];
+      const double bin = (x - offset) * scale;
+      if (bin >= 0.0 && bin < nbin)
+        iadd(data, static_cast<scipp::index>(bin), weights, i);
+    }
+  } else {
+    core::expect::histogram::sorted_edges(edges);
+    for (scipp::index i = 0; i < scipp::size(events); ++i) {
+      if (masked(i))
+        continue;
+      const auto x = events[i];
+      auto it = std::upper_bound(edges.begin(), edges.end(), x);
+      if (it != edges.end() && it != edges.begin())
+        iadd(data, --it - edges.begin(), weights, i);
+    }
+  }
+}
+
+inline units::Unit unit(const units::Unit &events_unit,
+                        const units::Unit &weights_unit,
+                        const units::Unit &edge_unit) {
+  if (events_unit != edge_unit)
+    throw except::UnitError(
+        "Bin edges must have same unit as the input coordinate.");
+  if (weights_unit != units::counts && weights_unit != units::dimensionless)
+    throw except::UnitError(
+        "Data to histogram must have unit `counts` or `dimensionless`.");
+  return weights_unit;
 }
+} // namespace histogram_detail
 
 static constexpr auto histogram = overloaded{
-    element::arg_list<
-        histogram_detail::args<float, double, float, double>,
-        histogram_detail::args<float, int64_t, float, double>,
-        histogram_detail::args<float, int32_t, float, double>,
-        histogram_detail::args<double, double, double, double>,
-        histogram_detail::args<double, float, double, double>,
-        histogram_detail::args<double, float, double, float>,
-        histogram_detail::args<double, double, float, double>,
-        histogram_detail::args<double, int64_t, double, int64_t>,
-        histogram_detail::args<double, int32_t, double, int64_t>,
-        histogram_detail::args<double, int64_t, double, int32_t>,
-        histogram_detail::args<double, int32_t, double, int32_t>,
-        histogram_detail::args<double, time_point, double, time_point>,
-        histogram_detail::args<double, time_point, float, time_point>,
-        histogram_detail::args<float, time_point, double, time_point>,
-        histogram_detail::args<float, time_point, float, time_point>>,
+    histogram_detail::types<histogram_detail::args>{},
     [](const auto &data, const auto &events, const auto &weights,
        const auto &edges) {
-      zero(data);
-      // Special implementation for linear bins. Gives a 1x to 20x speedup
-      // for few and many events per histogram, respectively.
-      if (scipp::numeric::islinspace(edges)) {
-        const auto [offset, nbin, scale] = core::linear_edge_params(edges);
-        for (scipp::index i = 0; i < scipp::size(events); ++i) {
-          const auto x = events[i];
-          const double bin = (x - offset) * scale;
-          if (bin >= 0.0 && bin < nbin)
-            iadd(data, static_cast<scipp::index>(bin), weights, i);
-        }
-      } else {
-        core::expect::histogram::sorted_edges(edges);
-        for (scipp::index i = 0; i < scipp::size(events); ++i) {
-          const auto x = events[i];
-          auto it = std::upper_bound(edges.begin(), edges.end(), x);
-          if (it != edges.end() && it != edges.begin())
-            iadd(data, --it - edges.begin(), weights, i);
-        }
-      }
+      histogram_detail::histogram([](const scipp::index) { return false; },
+                                  data, events, weights, edges);
     },
     [](const units::Unit &events_unit, const units::Unit &weights_unit,
        const units::Unit &edge_unit) {
-      if (events_unit != edge_unit)
-        throw except::UnitError(
-            "Bin edges must have same unit as the input coordinate.");
-      if (weights_unit != units::counts && weights_unit != units::dimensionless)
-        throw except::UnitError(
-            "Data to histogram must have unit `counts` or `dimensionless`.");
-      return weights_unit;
+      return histogram_detail::unit(events_unit, weights_unit, edge_unit);
     },
     transform_flags::expect_in_variance_if_out_variance,
     transform_flags::expect_no_variance_arg<1>,
     transform_flags::expect_no_variance_arg<3>};
 
+/// Histogram skipping events where the mask (last argument) is true.
+static constexpr auto histogram_masked = overloaded{
+    histogram_detail::types<histogram_detail::masked_args>{},
+    [](const auto &data, const auto &events, const auto &weights,
+       const auto &edges, const auto &mask) {
+      histogram_detail::histogram(
+          [&mask](const scipp::index i) { return mask[i]; }, data, events,
+          weights, edges);
+    },
+    [](const units::Unit &events_unit, const units::Unit &weights_unit,
+       const units::Unit &edge_unit, const units::Unit &mask_unit) {
+      core::expect::equals(mask_unit, units::one);
+      return histogram_detail::unit(events_unit, weights_unit, edge_unit);
+    },
+    transform_flags::expect_in_variance_if_out_variance,
+    transform_flags::expect_no_variance_arg<1>,
+    transform_flags::expect_no_variance_arg<3>,
+    transform_flags::expect_no_variance_arg<4>};
+
 } // namespace scipp::core::element
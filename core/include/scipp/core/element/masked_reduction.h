@@ -0,0 +1,60 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @author Simon Heybrock
+#pragma once
+
+#include <tuple>
+#include <type_traits>
+
+#include "scipp/common/overloaded.h"
+#include "scipp/core/element/arg_list.h"
+#include "scipp/core/element/arithmetic.h"
+#include "scipp/core/element/comparison.h"
+#include "scipp/core/element/logical.h"
+#include "scipp/core/except.h"
+#include "scipp/core/transform_common.h"
+#include "scipp/units/unit.h"
+
+namespace scipp::core::element {
+
+namespace masked_reduction_detail {
+template <class T> struct with_mask { using type = std::tuple<T, T, bool>; };
+template <class... Ts> struct with_mask<std::tuple<Ts...>> {
+  using type = std::tuple<Ts..., bool>;
+};
+template <class Types> struct arg_list_with_mask;
+template <class... Ts> struct arg_list_with_mask<std::tuple<Ts...>> {
+  using type = arg_list_t<typename with_mask<Ts>::type...>;
+};
+} // namespace masked_reduction_detail
+
+/// Return a kernel applying the in-place reduction `op` unless masked.
+///
+/// The kernel supports the same dtypes as `op` with an additional bool mask
+/// argument. This is used to reduce masked data without creating a copy with
+/// masked elements replaced by a neutral value.
+template <class Op> constexpr auto masked_reduce(Op op) {
+  using namespace masked_reduction_detail;
+  return overloaded{
+      typename arg_list_with_mask<typename Op::types>::type{},
+      transform_flags::conditional_flag<std::is_base_of_v<
+          transform_flags::expect_in_variance_if_out_variance_t, Op>>(
+          transform_flags::expect_in_variance_if_out_variance),
+      [op](auto &&out, const auto &data, const bool mask) {
+        if (!mask)
+          op(out, data);
+      },
+      [](const units::Unit &, const units::Unit &, const units::Unit &mask) {
+        core::expect::equals(mask, units::one);
+      }};
+}
+
+constexpr auto masked_add_equals = masked_reduce(add_equals);
+constexpr auto masked_nan_add_equals = masked_reduce(nan_add_equals);
+constexpr auto masked_max_equals = masked_reduce(max_equals);
+constexpr auto masked_min_equals = masked_reduce(min_equals);
+constexpr auto masked_logical_and_equals = masked_reduce(logical_and_equals);
+constexpr auto masked_logical_or_equals = masked_reduce(logical_or_equals);
+
+} // namespace scipp::core::element
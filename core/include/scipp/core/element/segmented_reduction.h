@@ -0,0 +1,65 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @author Simon Heybrock
+#pragma once
+
+#include "scipp/common/overloaded.h"
+#include "scipp/common/span.h"
+#include "scipp/core/element/arg_list.h"
+#include "scipp/core/element/arithmetic.h"
+#include "scipp/core/element/comparison.h"
+#include "scipp/core/element/logical.h"
+#include "scipp/core/except.h"
+#include "scipp/core/transform_common.h"
+#include "scipp/core/value_and_variance.h"
+#include "scipp/units/unit.h"
+
+namespace scipp::core::element {
+
+template <class... Ts>
+constexpr arg_list_t<std::tuple<scipp::span<Ts>, scipp::span<const Ts>,
+                                scipp::span<const scipp::index>>...>
+    segmented_reduce_arg_list{};
+
+/// Return a kernel reducing `data[i]` into `out[group[i]]` using `op`.
+///
+/// Rows with a negative group index are skipped. This is used for reducing
+/// many thin groups in a single pass over the input, instead of processing
+/// every group slice individually.
+template <class... Ts, class Op> constexpr auto segmented_reduce(Op op) {
+  return overloaded{
+      segmented_reduce_arg_list<Ts...>,
+      transform_flags::expect_in_variance_if_out_variance,
+      transform_flags::expect_no_variance_arg<2>,
+      [op](const auto &out, const auto &data, const auto &group) {
+        for (scipp::index i = 0; i < scipp::size(group); ++i) {
+          const auto g = group[i];
+          if (g < 0)
+            continue;
+          if constexpr (is_ValueAndVariance_v<std::decay_t<decltype(out)>>) {
+            ValueAndVariance acc{out.value[g], out.variance[g]};
+            op(acc, ValueAndVariance{data.value[i], data.variance[i]});
+            out.value[g] = acc.value;
+            out.variance[g] = acc.variance;
+          } else {
+            op(out[g], data[i]);
+          }
+        }
+      },
+      [](units::Unit &out, const units::Unit &data, const units::Unit &group) {
+        core::expect::equals(group, units::one);
+        core::expect::equals(out, data);
+      }};
+}
+
+constexpr auto segmented_sum =
+    segmented_reduce<double, float, int64_t, int32_t>(add_equals);
+constexpr auto segmented_max =
+    segmented_reduce<double, float, int64_t, int32_t, bool>(max_equals);
+constexpr auto segmented_min =
+    segmented_reduce<double, float, int64_t, int32_t, bool>(min_equals);
+constexpr auto segmented_all = segmented_reduce<bool>(logical_and_equals);
+constexpr auto segmented_any = segmented_reduce<bool>(logical_or_equals);
+
+} // namespace scipp::core::element
@@ -33,6 +33,9 @@ static constexpr auto init_for_overwrite = init_for_overwrite_t{};
 /// - As a minor benefit, since the implementation has to store a pointer and a
 ///   size, we can at the same time support an "optional" behavior, as used for
 ///   the array of variances in a variable.
+/// - Memory owned by another object, such as a NumPy array, can be used
+///   without copying. The owner is kept alive as long as the array uses its
+///   memory. Copies of the array always own their memory.
 template <class T> class element_array {
 public:
   using value_type = T;
@@ -77,9 +80,18 @@ public:
   element_array(std::initializer_list<T> init)
       : element_array(init.begin(), init.end()) {}
 
+  /// Construct from `size` elements at `data` without copying.
+  ///
+  /// The memory is not owned by the array. Instead, `owner` is kept alive until
+  /// the array is destroyed or its memory is replaced.
+  element_array(T *data, const scipp::index size, std::shared_ptr<void> owner)
+      : m_size(size), m_begin(data), m_owner(std::move(owner)) {}
+
   element_array(element_array &&other) noexcept
-      : m_size(other.m_size), m_data(std::move(other.m_data)) {
+      : m_size(other.m_size), m_begin(other.m_begin),
+        m_data(std::move(other.m_data)), m_owner(std::move(other.m_owner)) {
     other.m_size = -1;
+    other.m_begin = nullptr;
   }
 
   element_array(const element_array &other)
@@ -87,8 +99,11 @@ public:
 
   element_array &operator=(element_array &&other) noexcept {
     m_data = std::move(other.m_data);
+    m_owner = std::move(other.m_owner);
+    m_begin = other.m_begin;
     m_size = other.m_size;
     other.m_size = -1;
+    other.m_begin = nullptr;
     return *this;
   }
 
@@ -99,8 +114,12 @@ public:
   explicit operator bool() const noexcept { return m_size != -1; }
   scipp::index size() const noexcept { return m_size; }
   [[nodiscard]] bool empty() const noexcept { return size() == 0; }
-  const T *data() const noexcept { return m_data.get(); }
-  T *data() noexcept { return m_data.get(); }
+  const T *data() const noexcept { return m_begin; }
+  T *data() noexcept { return m_begin; }
+  /// Return true if the memory is owned by another object.
+  [[nodiscard]] bool is_external() const noexcept {
+    return static_cast<bool>(m_owner);
+  }
   const T *begin() const noexcept { return data(); }
   T *begin() noexcept { return data(); }
   const T *end() const noexcept {
@@ -110,6 +129,8 @@ public:
 
   void reset() noexcept {
     m_data.reset();
+    m_owner.reset();
+    m_begin = nullptr;
     m_size = -1;
   }
 
@@ -122,10 +143,12 @@ public:
   /// Resize with default-initialized elements. Use with care.
   void resize(const scipp::index new_size, const init_for_overwrite_t &) {
     if (new_size == 0) {
-      m_data.reset();
+      reset();
       m_size = 0;
-    } else if (new_size != size()) {
+    } else if (new_size != size() || is_external()) {
       m_data = make_unique_for_overwrite<T[]>(new_size);
+      m_owner.reset();
+      m_begin = m_data.get();
       m_size = new_size;
     }
   }
@@ -141,7 +164,9 @@ private:
     }
   }
   scipp::index m_size{-1};
+  T *m_begin{nullptr};
   std::unique_ptr<T[]> m_data;
+  std::shared_ptr<void> m_owner;
 };
 
 } // namespace scipp::core
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <algorithm>
+#include <memory>
 
 #include <boost/iterator/iterator_facade.hpp>
 
@@ -17,9 +18,20 @@ namespace scipp::core {
 
 struct SCIPP_CORE_EXPORT BucketParams {
   explicit operator bool() const noexcept { return dim != Dim::Invalid; }
+  /// Return the begin and end index of bin `i` in the buffer.
+  constexpr std::pair<scipp::index, scipp::index>
+  range(const scipp::index i) const noexcept {
+    return offsets ? std::pair{offsets[i], offsets[i + 1]} : indices[i];
+  }
   Dim dim{Dim::Invalid};
   Dimensions dims{};
   const std::pair<scipp::index, scipp::index> *indices{nullptr};
+  /// Alternative to `indices` for contiguous bins, bin `i` is given by
+  /// `[offsets[i], offsets[i + 1])`.
+  const scipp::index *offsets{nullptr};
+  /// Owner of the memory of `offsets`, which the bin model drops when
+  /// converting offsets into indices.
+  std::shared_ptr<const void> offsets_owner{};
 };
 
 template <class T>
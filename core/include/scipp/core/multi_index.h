@@ -122,7 +122,7 @@ public:
       return; // at end or dense
     // All bins are guaranteed to have the same size.
     // Use common m_shape and m_nested_stride for all.
-    const auto [begin, end] = m_bin[i].m_indices[m_bin[i].m_bin_index];
+    const auto [begin, end] = m_bin[i].range();
     m_shape[m_nested_dim_index] = end - begin;
     m_data_index[i] = m_nested_stride * begin;
   }
@@ -303,12 +303,23 @@ private:
   struct BinIterator {
     BinIterator() = default;
     explicit BinIterator(const ElementArrayViewParams &params)
-        : m_indices{params.bucketParams().indices} {}
+        : m_indices{params.bucketParams().indices},
+          m_offsets{params.bucketParams().offsets} {}
 
-    [[nodiscard]] bool is_binned() noexcept { return m_indices != nullptr; }
+    [[nodiscard]] bool is_binned() noexcept {
+      return m_indices != nullptr || m_offsets != nullptr;
+    }
+
+    [[nodiscard]] constexpr std::pair<scipp::index, scipp::index>
+    range() const noexcept {
+      return m_offsets
+                 ? std::pair{m_offsets[m_bin_index], m_offsets[m_bin_index + 1]}
+                 : m_indices[m_bin_index];
+    }
 
     scipp::index m_bin_index{0};
     const std::pair<scipp::index, scipp::index> *m_indices{nullptr};
+    const scipp::index *m_offsets{nullptr};
   };
   std::array<scipp::index, N> m_data_index = {};
   // This does *not* 0-init the inner arrays!
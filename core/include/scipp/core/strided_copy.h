@@ -0,0 +1,147 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @author Simon Heybrock
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+#include "scipp/common/index.h"
+#include "scipp/common/span.h"
+#include "scipp/core/parallel.h"
+
+namespace scipp::core {
+
+namespace detail {
+/// Shape and strides of a copy between two strided arrays.
+struct StridedCopyLayout {
+  std::vector<scipp::index> shape;
+  std::vector<scipp::index> src_strides;
+  std::vector<scipp::index> dst_strides;
+
+  [[nodiscard]] scipp::index volume() const noexcept {
+    scipp::index volume = 1;
+    for (const auto extent : shape)
+      volume *= extent;
+    return volume;
+  }
+};
+
+/// Return the layout of a copy with dims of extent 1 removed and adjacent dims
+/// merged if they are contiguous relative to each other in both source and
+/// destination.
+inline StridedCopyLayout
+coalesce_dims(const scipp::span<const scipp::index> shape,
+              const scipp::span<const scipp::index> src_strides,
+              const scipp::span<const scipp::index> dst_strides) {
+  StridedCopyLayout layout;
+  for (size_t d = 0; d < shape.size(); ++d) {
+    if (shape[d] == 0)
+      return {{0}, {0}, {0}};
+    if (shape[d] == 1)
+      continue;
+    if (!layout.shape.empty() &&
+        layout.src_strides.back() == shape[d] * src_strides[d] &&
+        layout.dst_strides.back() == shape[d] * dst_strides[d]) {
+      layout.shape.back() *= shape[d];
+      layout.src_strides.back() = src_strides[d];
+      layout.dst_strides.back() = dst_strides[d];
+    } else {
+      layout.shape.push_back(shape[d]);
+      layout.src_strides.push_back(src_strides[d]);
+      layout.dst_strides.push_back(dst_strides[d]);
+    }
+  }
+  return layout;
+}
+
+struct assign_element {
+  template <class Dst, class Src> void operator()(Dst &dst, const Src &src) {
+    dst = src;
+  }
+};
+} // namespace detail
+
+/// Approximate number of bytes copied by each task in strided_copy.
+constexpr scipp::index strided_copy_grain_bytes = 65536;
+
+/// Copy an array of given `shape` from `src` to `dst`, calling
+/// `assign(dst_element, src_element)` for every element.
+///
+/// Strides are given in elements and must be in the same order as `shape`, with
+/// the slowest moving dimension first. Dimensions that are contiguous in both
+/// arrays are merged and the work is split into chunks of similar size in
+/// bytes. Contiguous runs are copied with memcpy if the element types are equal
+/// and trivially copyable and `assign` is the default. The arrays must not
+/// overlap.
+template <class Src, class Dst, class Assign = detail::assign_element>
+void strided_copy(const scipp::span<const scipp::index> shape, const Src *src,
+                  const scipp::span<const scipp::index> src_strides, Dst *dst,
+                  const scipp::span<const scipp::index> dst_strides,
+                  Assign assign = Assign{}) {
+  const auto layout = detail::coalesce_dims(shape, src_strides, dst_strides);
+  const auto volume = layout.volume();
+  if (volume == 0)
+    return;
+  if (layout.shape.empty())
+    return assign(*dst, *src);
+
+  constexpr bool use_memcpy =
+      std::is_same_v<std::remove_cv_t<Src>, Dst> &&
+      std::is_trivially_copyable_v<Dst> &&
+      std::is_same_v<Assign, detail::assign_element>;
+  const auto ndim = scipp::size(layout.shape);
+  const auto inner = ndim - 1;
+  const auto inner_extent = layout.shape[inner];
+  const auto src_inner = layout.src_strides[inner];
+  const auto dst_inner = layout.dst_strides[inner];
+  // Copy `n` elements along the inner dim, starting at the given offsets.
+  const auto copy_run = [&](const scipp::index n, const scipp::index src_offset,
+                            const scipp::index dst_offset) {
+    if constexpr (use_memcpy) {
+      if (src_inner == 1 && dst_inner == 1) {
+        std::memcpy(dst + dst_offset, src + src_offset, n * sizeof(Dst));
+        return;
+      }
+    }
+    for (scipp::index k = 0; k < n; ++k)
+      assign(dst[dst_offset + k * dst_inner], src[src_offset + k * src_inner]);
+  };
+  const auto grain = std::max(
+      scipp::index(1), strided_copy_grain_bytes /
+                           static_cast<scipp::index>(sizeof(Dst)));
+  parallel::parallel_for(
+      parallel::blocked_range(0, volume, grain), [&](const auto &range) {
+        std::vector<scipp::index> index(ndim);
+        scipp::index src_offset = 0;
+        scipp::index dst_offset = 0;
+        for (scipp::index d = inner, flat = range.begin(); d >= 0; --d) {
+          index[d] = flat % layout.shape[d];
+          flat /= layout.shape[d];
+          src_offset += index[d] * layout.src_strides[d];
+          dst_offset += index[d] * layout.dst_strides[d];
+        }
+        for (scipp::index i = range.begin(); i < range.end();) {
+          const auto n = std::min(inner_extent - index[inner], range.end() - i);
+          copy_run(n, src_offset, dst_offset);
+          i += n;
+          index[inner] += n;
+          src_offset += n * src_inner;
+          dst_offset += n * dst_inner;
+          for (scipp::index d = inner; d > 0 && index[d] == layout.shape[d];
+               --d) {
+            index[d] = 0;
+            ++index[d - 1];
+            src_offset += layout.src_strides[d - 1] -
+                          layout.shape[d] * layout.src_strides[d];
+            dst_offset += layout.dst_strides[d - 1] -
+                          layout.shape[d] * layout.dst_strides[d];
+          }
+        }
+      });
+}
+
+} // namespace scipp::core
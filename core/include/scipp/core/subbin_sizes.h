@@ -5,7 +5,8 @@
 #pragma once
 
 #include <string>
-#include <vector>
+
+#include <boost/container/small_vector.hpp>
 
 #include "scipp-core_export.h"
 #include "scipp/common/index.h"
@@ -13,9 +14,13 @@
 namespace scipp::core {
 
 /// Helper of `bin` for representing rows of a sparse subbin-size array.
+///
+/// Rows are typically short, e.g., when rebinning along an existing dimension
+/// each input bin overlaps with only a few output bins. Sizes are therefore
+/// stored inline for short rows to avoid a heap allocation for every input bin.
 class SCIPP_CORE_EXPORT SubbinSizes {
 public:
-  using container_type = std::vector<scipp::index>;
+  using container_type = boost::container::small_vector<scipp::index, 4>;
   SubbinSizes() = default;
   SubbinSizes(const scipp::index value);
   SubbinSizes(const scipp::index offset, container_type &&sizes);
@@ -26,11 +31,13 @@ public:
   SubbinSizes &operator-=(const SubbinSizes &other);
 
   SubbinSizes cumsum_exclusive() const;
+  void exclusive_scan(SubbinSizes &x);
   scipp::index sum() const;
   void trim_to(const SubbinSizes &other);
   SubbinSizes &add_intersection(const SubbinSizes &other);
 
 private:
+  void realign(const scipp::index offset, const scipp::index size);
   scipp::index m_offset{0};
   container_type m_sizes;
 };
@@ -11,14 +11,14 @@ void validate_bin_indices_impl(const ElementArrayViewParams &param0,
                                const ElementArrayViewParams &param1) {
   const auto iterDims = param0.dims();
   auto index = MultiIndex(iterDims, param0.strides(), param1.strides());
-  const auto indices0 = param0.bucketParams().indices;
-  const auto indices1 = param1.bucketParams().indices;
+  const auto &bins0 = param0.bucketParams();
+  const auto &bins1 = param1.bucketParams();
   constexpr auto size = [](const auto range) {
     return range.second - range.first;
   };
   for (scipp::index i = 0; i < iterDims.volume(); ++i) {
     const auto [i0, i1] = index.get();
-    if (size(indices0[i0]) != size(indices1[i1]))
+    if (size(bins0.range(i0)) != size(bins1.range(i1)))
       throw except::BinnedDataError(
           "Bin size mismatch in operation with binned data. Refer to "
           "https://scipp.github.io/user-guide/binned-data/"
@@ -26,20 +26,46 @@ void SubbinSizes::operator=(const scipp::index value) {
     size = value;
 }
 
+/// Move sizes in-place to cover the range [offset, offset + size), padding
+/// with zeros and dropping sizes outside the range.
+void SubbinSizes::realign(const scipp::index offset, const scipp::index size) {
+  const auto shift = offset - m_offset;
+  const auto old_size = scipp::size(m_sizes);
+  const auto get = [&](const scipp::index i) {
+    return i >= 0 && i < old_size ? m_sizes[i] : 0;
+  };
+  m_sizes.resize(std::max(old_size, size));
+  if (shift >= 0) {
+    for (scipp::index i = 0; i < size; ++i)
+      m_sizes[i] = get(i + shift);
+  } else {
+    for (scipp::index i = size - 1; i >= 0; --i)
+      m_sizes[i] = get(i + shift);
+  }
+  m_sizes.resize(size);
+  m_offset = offset;
+}
+
 SubbinSizes &SubbinSizes::operator+=(const SubbinSizes &other) {
-  if (other.offset() < offset()) // avoid realloc if possible
-    return *this = *this + other;
+  const auto begin = std::min(offset(), other.offset());
+  const auto end = std::max(offset() + scipp::size(sizes()),
+                            other.offset() + scipp::size(other.sizes()));
+  realign(begin, end - begin);
   scipp::index current = other.offset() - offset();
-  const auto length = current + scipp::size(other.sizes());
-  if (length > scipp::size(sizes()))
-    m_sizes.resize(length);
   for (const auto &x : other.sizes())
     m_sizes[current++] += x;
   return *this;
 }
 
 SubbinSizes &SubbinSizes::operator-=(const SubbinSizes &other) {
-  return *this = *this - other;
+  const auto begin = std::min(offset(), other.offset());
+  const auto end = std::max(offset() + scipp::size(sizes()),
+                            other.offset() + scipp::size(other.sizes()));
+  realign(begin, end - begin);
+  scipp::index current = other.offset() - offset();
+  for (const auto &x : other.sizes())
+    m_sizes[current++] -= x;
+  return *this;
 }
 
 SubbinSizes SubbinSizes::cumsum_exclusive() const {
@@ -50,24 +76,25 @@ SubbinSizes SubbinSizes::cumsum_exclusive() const {
   return {offset(), std::move(out)};
 }
 
+/// Exclusive scan step with `this` as the cumulative sum, in-place.
+///
+/// Equivalent to `trim_to(x); *this += x; x = *this - x;` but does not
+/// allocate unless the range of `x` exceeds the capacity of `this`.
+void SubbinSizes::exclusive_scan(SubbinSizes &x) {
+  realign(x.offset(), scipp::size(x.sizes()));
+  for (scipp::index i = 0; i < scipp::size(m_sizes); ++i) {
+    const auto size = x.m_sizes[i];
+    x.m_sizes[i] = m_sizes[i];
+    m_sizes[i] += size;
+  }
+}
+
 scipp::index SubbinSizes::sum() const {
   return std::accumulate(sizes().begin(), sizes().end(), scipp::index{0});
 }
 
 void SubbinSizes::trim_to(const SubbinSizes &other) {
-  auto out = other; // TODO in principle this allocation could be avoided, but
-                    // initial implementation attempts got messy.
-  out = 0;
-  // full index begin/end
-  const auto begin = std::max(offset(), out.offset());
-  const auto end = std::min(offset() + scipp::size(sizes()),
-                            out.offset() + scipp::size(out.sizes()));
-  const auto ibegin =
-      sizes().begin() + std::max(begin - offset(), scipp::index(0));
-  const auto obegin =
-      out.m_sizes.begin() + std::max(begin - out.offset(), scipp::index(0));
-  std::copy_n(ibegin, std::max(scipp::index(0), end - begin), obegin);
-  *this = std::move(out);
+  realign(other.offset(), scipp::size(other.sizes()));
 }
 
 SubbinSizes &SubbinSizes::add_intersection(const SubbinSizes &other) {
@@ -0,0 +1,110 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <random>
+
+#include "scipp/core/argsort.h"
+
+using namespace scipp;
+using namespace scipp::core;
+
+namespace {
+template <class T>
+std::vector<scipp::index> reference(const std::vector<T> &values,
+                                    const SortOrder order) {
+  std::vector<scipp::index> indices(values.size());
+  std::iota(indices.begin(), indices.end(), scipp::index(0));
+  std::stable_sort(indices.begin(), indices.end(), [&](auto a, auto b) {
+    return order == SortOrder::Ascending ? values[a] < values[b]
+                                         : values[b] < values[a];
+  });
+  return indices;
+}
+
+template <class T> auto argsort(const std::vector<T> &values, SortOrder order) {
+  return core::argsort(scipp::span<const T>(values), order);
+}
+} // namespace
+
+TEST(ArgsortTest, empty) {
+  EXPECT_TRUE(argsort(std::vector<double>{}, SortOrder::Ascending).empty());
+  EXPECT_TRUE(
+      argsort(std::vector<std::string>{}, SortOrder::Ascending).empty());
+}
+
+TEST(ArgsortTest, int64) {
+  const std::vector<int64_t> values{3, -1, 2, -1, 0, 3,
+                                    std::numeric_limits<int64_t>::lowest(),
+                                    std::numeric_limits<int64_t>::max()};
+  for (const auto order : {SortOrder::Ascending, SortOrder::Descending})
+    EXPECT_EQ(argsort(values, order), reference(values, order));
+}
+
+TEST(ArgsortTest, int32) {
+  const std::vector<int32_t> values{10, 20, -1, 20, 5};
+  EXPECT_EQ(argsort(values, SortOrder::Ascending),
+            (std::vector<scipp::index>{2, 4, 0, 1, 3}));
+  EXPECT_EQ(argsort(values, SortOrder::Descending),
+            (std::vector<scipp::index>{1, 3, 0, 4, 2}));
+}
+
+TEST(ArgsortTest, bool) {
+  const std::vector<bool> flags{true, false, true, false};
+  const std::unique_ptr<bool[]> values(new bool[4]);
+  std::copy(flags.begin(), flags.end(), values.get());
+  const scipp::span<const bool> span(values.get(), 4);
+  EXPECT_EQ(core::argsort(span, SortOrder::Ascending),
+            (std::vector<scipp::index>{1, 3, 0, 2}));
+  EXPECT_EQ(core::argsort(span, SortOrder::Descending),
+            (std::vector<scipp::index>{0, 2, 1, 3}));
+}
+
+TEST(ArgsortTest, time_point) {
+  const std::vector<time_point> values{time_point{5}, time_point{-2},
+                                       time_point{5}, time_point{1}};
+  EXPECT_EQ(argsort(values, SortOrder::Ascending),
+            (std::vector<scipp::index>{1, 3, 0, 2}));
+}
+
+TEST(ArgsortTest, double_special_values) {
+  constexpr auto nan = std::numeric_limits<double>::quiet_NaN();
+  constexpr auto inf = std::numeric_limits<double>::infinity();
+  const std::vector<double> values{1.5, nan, -inf, 0.0, -0.0, inf, -nan, -2.5};
+  EXPECT_EQ(argsort(values, SortOrder::Ascending),
+            (std::vector<scipp::index>{2, 7, 3, 4, 0, 5, 1, 6}));
+  EXPECT_EQ(argsort(values, SortOrder::Descending),
+            (std::vector<scipp::index>{1, 6, 5, 0, 3, 4, 7, 2}));
+}
+
+TEST(ArgsortTest, float) {
+  const std::vector<float> values{1.5f, -0.5f, 1e30f, -1e-30f, 0.0f};
+  for (const auto order : {SortOrder::Ascending, SortOrder::Descending})
+    EXPECT_EQ(argsort(values, order), reference(values, order));
+}
+
+TEST(ArgsortTest, string) {
+  const std::vector<std::string> values{"b", "a", "c", "a", ""};
+  for (const auto order : {SortOrder::Ascending, SortOrder::Descending})
+    EXPECT_EQ(argsort(values, order), reference(values, order));
+}
+
+TEST(ArgsortTest, large) {
+  std::mt19937 rng(1234);
+  std::uniform_int_distribution<int64_t> dist(-1000, 1000);
+  std::vector<double> values(300000);
+  std::vector<std::string> strings(values.size());
+  for (size_t i = 0; i < values.size(); ++i) {
+    values[i] = 0.25 * dist(rng);
+    strings[i] = std::to_string(dist(rng));
+  }
+  for (const auto order : {SortOrder::Ascending, SortOrder::Descending}) {
+    EXPECT_EQ(argsort(values, order), reference(values, order));
+    EXPECT_EQ(argsort(strings, order), reference(strings, order));
+  }
+}
@@ -3,6 +3,7 @@
 #include <gtest/gtest.h>
 
 #include <array>
+#include <memory>
 #include <vector>
 
 #include "scipp/core/element_array.h"
@@ -180,3 +181,28 @@ TEST(ElementArrayTest, resize_default_init) {
   x.resize(0, init_for_overwrite);
   check_empty_element_array(x);
 }
+
+TEST(ElementArrayTest, external_memory) {
+  auto owner = std::make_shared<std::vector<float>>(3, 1.5f);
+  std::weak_ptr<std::vector<float>> weak = owner;
+  element_array<float> x(owner->data(), 3, owner);
+  owner.reset();
+  ASSERT_FALSE(weak.expired());
+  ASSERT_TRUE(x.is_external());
+  ASSERT_EQ(x.size(), 3);
+  ASSERT_EQ(x.data(), weak.lock()->data());
+  x.data()[1] = 2.0f;
+  ASSERT_EQ(weak.lock()->at(1), 2.0f);
+
+  const auto copy(x);
+  ASSERT_FALSE(copy.is_external());
+  ASSERT_NE(copy.data(), x.data());
+  ASSERT_EQ(copy.data()[1], 2.0f);
+
+  auto moved(std::move(x));
+  ASSERT_TRUE(moved.is_external());
+  ASSERT_FALSE(weak.expired());
+  moved.resize(3, init_for_overwrite);
+  ASSERT_FALSE(moved.is_external());
+  ASSERT_TRUE(weak.expired());
+}
@@ -66,3 +66,14 @@ TEST(ElementHistogramTest, no_variance) {
   element::histogram(span(result_vals), events, span(weight_vals), edges);
   EXPECT_EQ(result_vals, std::vector<double>({20 + 30, 40 + 50}));
 }
+
+TEST(ElementHistogramTest, masked) {
+  std::vector<double> edges{2, 4, 6};
+  std::vector<double> events{1, 2, 3, 4, 5, 6, 7};
+  std::vector<double> weight_vals{10, 20, 30, 40, 50, 60, 70};
+  const bool mask[] = {false, true, false, false, true, false, false};
+  std::vector<double> result_vals{0, 0};
+  element::histogram_masked(span(result_vals), events, span(weight_vals),
+                            edges, span(mask));
+  EXPECT_EQ(result_vals, std::vector<double>({30, 40}));
+}
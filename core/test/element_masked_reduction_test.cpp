@@ -0,0 +1,74 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+#include <gtest/gtest.h>
+
+#include "scipp/core/element/masked_reduction.h"
+#include "scipp/units/unit.h"
+
+using namespace scipp;
+using namespace scipp::core;
+using namespace scipp::core::element;
+
+TEST(ElementMaskedReductionTest, types) {
+  static_assert(std::is_same_v<decltype(masked_logical_and_equals)::types,
+                               std::tuple<std::tuple<bool, bool, bool>>>);
+  static_assert(
+      std::is_same_v<std::tuple_element_t<
+                         16, decltype(masked_add_equals)::types>,
+                     std::tuple<int64_t, bool, bool>>);
+}
+
+TEST(ElementMaskedReductionTest, variance_flags) {
+  static_assert(
+      std::is_base_of_v<transform_flags::expect_in_variance_if_out_variance_t,
+                        decltype(masked_max_equals)>);
+  static_assert(
+      !std::is_base_of_v<transform_flags::expect_in_variance_if_out_variance_t,
+                         decltype(masked_add_equals)>);
+}
+
+TEST(ElementMaskedReductionTest, add_equals) {
+  double x = 1.0;
+  masked_add_equals(x, 2.0, false);
+  EXPECT_EQ(x, 3.0);
+  masked_add_equals(x, 4.0, true);
+  EXPECT_EQ(x, 3.0);
+  masked_add_equals(x, NAN, true);
+  EXPECT_EQ(x, 3.0);
+}
+
+TEST(ElementMaskedReductionTest, add_equals_variances) {
+  ValueAndVariance x{1.0, 2.0};
+  masked_add_equals(x, ValueAndVariance{2.0, 3.0}, false);
+  EXPECT_EQ(x, ValueAndVariance(3.0, 5.0));
+  masked_add_equals(x, ValueAndVariance{2.0, 3.0}, true);
+  EXPECT_EQ(x, ValueAndVariance(3.0, 5.0));
+}
+
+TEST(ElementMaskedReductionTest, max_min_equals) {
+  double max = 1.0;
+  double min = 1.0;
+  for (const auto mask : {true, false}) {
+    masked_max_equals(max, 2.0, mask);
+    masked_min_equals(min, 0.0, mask);
+  }
+  EXPECT_EQ(max, 2.0);
+  EXPECT_EQ(min, 0.0);
+  masked_max_equals(max, 3.0, true);
+  masked_min_equals(min, -1.0, true);
+  EXPECT_EQ(max, 2.0);
+  EXPECT_EQ(min, 0.0);
+}
+
+TEST(ElementMaskedReductionTest, logical) {
+  bool all = true;
+  bool any = false;
+  masked_logical_and_equals(all, false, true);
+  masked_logical_or_equals(any, true, true);
+  EXPECT_TRUE(all);
+  EXPECT_FALSE(any);
+  masked_logical_and_equals(all, false, false);
+  masked_logical_or_equals(any, true, false);
+  EXPECT_FALSE(all);
+  EXPECT_TRUE(any);
+}
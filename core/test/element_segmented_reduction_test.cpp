@@ -0,0 +1,74 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "scipp/core/element/segmented_reduction.h"
+#include "scipp/units/unit.h"
+
+using namespace scipp;
+using namespace scipp::core;
+using namespace scipp::core::element;
+
+class ElementSegmentedReductionTest : public ::testing::Test {
+protected:
+  const std::vector<scipp::index> group{1, 0, -1, 1, 0, 1};
+  const std::vector<double> data{1.0, 2.0, 4.0, 8.0, 16.0, 32.0};
+};
+
+TEST_F(ElementSegmentedReductionTest, unit) {
+  units::Unit out = units::m;
+  EXPECT_NO_THROW(segmented_sum(out, units::m, units::one));
+  EXPECT_EQ(out, units::m);
+  EXPECT_THROW(segmented_sum(out, units::s, units::one), except::UnitError);
+  EXPECT_THROW(segmented_sum(out, units::m, units::m), except::UnitError);
+}
+
+TEST_F(ElementSegmentedReductionTest, sum) {
+  std::vector<double> out{0.0, 0.0};
+  segmented_sum(scipp::span<double>(out), scipp::span<const double>(data),
+                scipp::span<const scipp::index>(group));
+  EXPECT_EQ(out, (std::vector<double>{18.0, 41.0}));
+}
+
+TEST_F(ElementSegmentedReductionTest, sum_variances) {
+  std::vector<double> out{0.0, 0.0};
+  std::vector<double> out_var{1.0, 2.0};
+  const std::vector<double> var{1.0, 1.0, 1.0, 1.0, 1.0, 1.0};
+  segmented_sum(ValueAndVariance{scipp::span<double>(out),
+                                 scipp::span<double>(out_var)},
+                ValueAndVariance{scipp::span<const double>(data),
+                                 scipp::span<const double>(var)},
+                scipp::span<const scipp::index>(group));
+  EXPECT_EQ(out, (std::vector<double>{18.0, 41.0}));
+  EXPECT_EQ(out_var, (std::vector<double>{3.0, 5.0}));
+}
+
+TEST_F(ElementSegmentedReductionTest, max) {
+  std::vector<double> out{-1.0, 100.0};
+  segmented_max(scipp::span<double>(out), scipp::span<const double>(data),
+                scipp::span<const scipp::index>(group));
+  EXPECT_EQ(out, (std::vector<double>{16.0, 100.0}));
+}
+
+TEST_F(ElementSegmentedReductionTest, min) {
+  std::vector<double> out{100.0, 0.0};
+  segmented_min(scipp::span<double>(out), scipp::span<const double>(data),
+                scipp::span<const scipp::index>(group));
+  EXPECT_EQ(out, (std::vector<double>{2.0, 0.0}));
+}
+
+TEST_F(ElementSegmentedReductionTest, all_any) {
+  const bool flags[] = {true, false, false, true, true, true};
+  bool all[] = {true, true};
+  bool any[] = {false, false};
+  segmented_all(scipp::span<bool>(all), scipp::span<const bool>(flags),
+                scipp::span<const scipp::index>(group));
+  segmented_any(scipp::span<bool>(any), scipp::span<const bool>(flags),
+                scipp::span<const scipp::index>(group));
+  EXPECT_FALSE(all[0]);
+  EXPECT_TRUE(all[1]);
+  EXPECT_TRUE(any[0]);
+  EXPECT_TRUE(any[1]);
+}
@@ -71,6 +71,16 @@ protected:
     MultiIndex<1> index(ElementArrayViewParams{0, iter_dims, strides, params});
     check(index, expected);
   }
+  void check_with_bucket_offsets(const Dimensions &buffer_dims,
+                                 const Dim slice_dim,
+                                 const std::vector<scipp::index> &offsets,
+                                 const Dimensions &iter_dims,
+                                 const Strides &strides,
+                                 const std::vector<scipp::index> &expected) {
+    BucketParams params{slice_dim, buffer_dims, nullptr, offsets.data()};
+    MultiIndex<1> index(ElementArrayViewParams{0, iter_dims, strides, params});
+    check(index, expected);
+  }
   void check_with_buckets(
       const Dimensions &buffer_dims0, const Dim slice_dim0,
       const std::vector<std::pair<scipp::index, scipp::index>> &indices0,
@@ -248,6 +258,26 @@ TEST_F(MultiIndexTest, 2d_array_of_1d_buckets) {
                      make_strides(y, xy), {0, 1, 2, 3, 4, 5});
 }
 
+TEST_F(MultiIndexTest, 2d_array_of_1d_buckets_offsets) {
+  const Dim dim = Dim::Row;
+  Dimensions buf{dim, 12}; // 1d cut into xy=2x3 sections
+  const std::vector<scipp::index> offsets{0, 2, 4, 6, 8, 10, 12};
+  check_with_bucket_offsets(buf, dim, offsets, xy, make_strides(xy, xy),
+                            {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11});
+  check_with_bucket_offsets(buf, dim, {1, 2, 2, 5, 6, 12, 12}, xy,
+                            make_strides(xy, xy),
+                            {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11});
+  // transpose
+  check_with_bucket_offsets(buf, dim, offsets, yx, make_strides(yx, xy),
+                            {0, 1, 6, 7, 2, 3, 8, 9, 4, 5, 10, 11});
+  // slice inner
+  check_with_bucket_offsets(buf, dim, offsets, x, make_strides(x, xy),
+                            {0, 1, 6, 7});
+  // slice outer
+  check_with_bucket_offsets(buf, dim, offsets, y, make_strides(y, xy),
+                            {0, 1, 2, 3, 4, 5});
+}
+
 TEST_F(MultiIndexTest, 1d_array_of_1d_buckets_and_dense) {
   const Dim dim = Dim::Row;
   Dimensions buf{dim, 7}; // 1d cut into two sections
@@ -0,0 +1,96 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+#include <gtest/gtest.h>
+
+#include <numeric>
+#include <vector>
+
+#include "scipp/core/strided_copy.h"
+
+using namespace scipp;
+using scipp::core::strided_copy;
+
+namespace {
+std::vector<scipp::index> contiguous_strides(std::vector<scipp::index> shape) {
+  std::vector<scipp::index> strides(shape.size());
+  scipp::index stride = 1;
+  for (auto d = scipp::size(shape) - 1; d >= 0; --d) {
+    strides[d] = stride;
+    stride *= shape[d];
+  }
+  return strides;
+}
+} // namespace
+
+TEST(StridedCopyTest, coalesce_contiguous) {
+  const std::vector<scipp::index> shape{2, 1, 3, 4};
+  const auto strides = contiguous_strides(shape);
+  const auto layout = core::detail::coalesce_dims(shape, strides, strides);
+  EXPECT_EQ(layout.shape, std::vector<scipp::index>{24});
+  EXPECT_EQ(layout.src_strides, std::vector<scipp::index>{1});
+  EXPECT_EQ(layout.dst_strides, std::vector<scipp::index>{1});
+}
+
+TEST(StridedCopyTest, coalesce_keeps_non_contiguous) {
+  const std::vector<scipp::index> shape{2, 3, 4};
+  const std::vector<scipp::index> src_strides{24, 4, 1};
+  const auto dst_strides = contiguous_strides(shape);
+  const auto layout =
+      core::detail::coalesce_dims(shape, src_strides, dst_strides);
+  EXPECT_EQ(layout.shape, (std::vector<scipp::index>{2, 12}));
+  EXPECT_EQ(layout.src_strides, (std::vector<scipp::index>{24, 1}));
+}
+
+TEST(StridedCopyTest, contiguous_6d) {
+  const std::vector<scipp::index> shape{2, 3, 1, 2, 4, 5};
+  std::vector<double> src(240);
+  std::iota(src.begin(), src.end(), 0.0);
+  std::vector<double> dst(240);
+  const auto strides = contiguous_strides(shape);
+  strided_copy(shape, src.data(), strides, dst.data(), strides);
+  EXPECT_EQ(dst, src);
+}
+
+TEST(StridedCopyTest, transposed_large) {
+  // Large enough to be split into several chunks.
+  const std::vector<scipp::index> shape{300, 200};
+  std::vector<int64_t> src(60000);
+  std::iota(src.begin(), src.end(), 0);
+  std::vector<int64_t> dst(60000);
+  strided_copy(shape, src.data(), std::vector<scipp::index>{1, 300},
+               dst.data(), contiguous_strides(shape));
+  for (scipp::index i = 0; i < 300; ++i)
+    for (scipp::index j = 0; j < 200; ++j)
+      ASSERT_EQ(dst[i * 200 + j], j * 300 + i);
+}
+
+TEST(StridedCopyTest, strided_source_and_destination) {
+  const std::vector<scipp::index> shape{2, 3};
+  const std::vector<double> src{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+  std::vector<double> dst(18, -1.0);
+  strided_copy(shape, src.data(), std::vector<scipp::index>{6, 2},
+               dst.data() + 1, std::vector<scipp::index>{9, 3});
+  EXPECT_EQ(dst, (std::vector<double>{-1, 0, -1, -1, 2, -1, -1, 4, -1, -1, 6,
+                                      -1, -1, 8, -1, -1, 10, -1}));
+}
+
+TEST(StridedCopyTest, converting_assign) {
+  const std::vector<scipp::index> shape{3};
+  const std::vector<scipp::index> strides{1};
+  const std::vector<int32_t> src{1, 2, 3};
+  std::vector<double> dst(3);
+  strided_copy(shape, src.data(), strides, dst.data(), strides,
+               [](double &a, const int32_t b) { a = 0.5 * b; });
+  EXPECT_EQ(dst, (std::vector<double>{0.5, 1.0, 1.5}));
+}
+
+TEST(StridedCopyTest, scalar_and_empty) {
+  const std::vector<scipp::index> scalar_shape{};
+  const double src = 2.0;
+  double dst = 0.0;
+  strided_copy(scalar_shape, &src, scalar_shape, &dst, scalar_shape);
+  EXPECT_EQ(dst, 2.0);
+  const std::vector<scipp::index> empty_shape{2, 0};
+  strided_copy(empty_shape, &src, empty_shape, &dst, empty_shape);
+  EXPECT_EQ(dst, 2.0);
+}
@@ -105,3 +105,19 @@ TEST_F(SubbinSizesTest, minus) {
   EXPECT_EQ(x - SubbinSizes({6, {-1}}), SubbinSizes(2, {1, 2, 3, 0, 1}));
   EXPECT_EQ(x - SubbinSizes({0, {-1}}), SubbinSizes(0, {1, 0, 1, 2, 3}));
 }
+
+TEST_F(SubbinSizesTest, exclusive_scan) {
+  SubbinSizes sum(0, {0});
+  SubbinSizes x(2, {1, 2, 3});
+  sum.exclusive_scan(x);
+  EXPECT_EQ(x, SubbinSizes(2, {0, 0, 0}));
+  EXPECT_EQ(sum, SubbinSizes(2, {1, 2, 3}));
+  SubbinSizes y(1, {1, 1, 1});
+  sum.exclusive_scan(y);
+  EXPECT_EQ(y, SubbinSizes(1, {0, 1, 2}));
+  EXPECT_EQ(sum, SubbinSizes(1, {1, 2, 3}));
+  SubbinSizes z(3, {1, 1, 1, 1, 1, 1});
+  sum.exclusive_scan(z);
+  EXPECT_EQ(z, SubbinSizes(3, {3, 0, 0, 0, 0, 0}));
+  EXPECT_EQ(sum, SubbinSizes(3, {4, 1, 1, 1, 1, 1}));
+}
@@ -15,6 +15,7 @@
 #include "scipp/variable/bin_util.h"
 #include "scipp/variable/bins.h"
 #include "scipp/variable/cumulative.h"
+#include "scipp/variable/linear_range.h"
 #include "scipp/variable/reduction.h"
 #include "scipp/variable/shape.h"
 #include "scipp/variable/subspan_view.h"
@@ -26,6 +27,7 @@
 #include "scipp/dataset/bins_view.h"
 #include "scipp/dataset/except.h"
 
+#include "../variable/operations_common.h"
 #include "dataset_operations_common.h"
 
 using namespace scipp::variable::bin_detail;
@@ -73,8 +75,29 @@ Variable groups_to_map(const Variable &var, const Dim dim) {
                              "scipp.bin.groups_to_map");
 }
 
+/// Group using the linear range of integer `groups`, if any.
+template <class T>
+bool update_indices_by_grouping_linear(Variable &indices, const Variable &key,
+                                       const Variable &groups) {
+  const auto range = variable::linear_range<T>(groups);
+  if (!range || range->step == T{0} || key.dtype() != dtype<T>)
+    return false;
+  const auto dim = groups.dims().inner();
+  const auto params = makeVariable<T>(
+      Dims{dim}, Shape{3}, groups.unit(),
+      Values{range->start, range->step, static_cast<T>(range->size)});
+  variable::transform_in_place(
+      indices, key, subspan_view(params, dim),
+      core::element::update_indices_by_grouping_linear,
+      "scipp.bin.update_indices_by_grouping_linear");
+  return true;
+}
+
 void update_indices_by_grouping(Variable &indices, const Variable &key,
                                 const Variable &groups) {
+  if (update_indices_by_grouping_linear<int64_t>(indices, key, groups) ||
+      update_indices_by_grouping_linear<int32_t>(indices, key, groups))
+    return;
   const auto dim = groups.dims().inner();
   const auto map = (indices.dtype() == dtype<int64_t>)
                        ? groups_to_map<int64_t>(groups, dim)
@@ -221,8 +244,8 @@ DataArray add_metadata(std::tuple<DataArray, Variable> &&proto,
   for (const auto &[dim_, coord] : attrs)
     if (!rebinned(coord))
       out_attrs[dim_] = copy(coord);
-  return DataArray{
-      make_bins(zip(end - bin_sizes, end), buffer_dim, std::move(buffer)),
+  return DataArray{variable::make_bins_contiguous(zip(end - bin_sizes, end),
+                                                 buffer_dim, std::move(buffer)),
       std::move(out_coords), std::move(out_masks), std::move(out_attrs)};
 }
 
@@ -472,7 +495,8 @@ template <class T> Variable concat_bins(const Variable &var, const Dim dim) {
   bin_sizes = squeeze(bin_sizes, {dim});
   const auto end = cumsum(bin_sizes);
   const auto buffer_dim = buffer.dims().inner();
-  return make_bins(zip(end - bin_sizes, end), buffer_dim, std::move(buffer));
+  return variable::make_bins_contiguous(zip(end - bin_sizes, end), buffer_dim,
+                                        std::move(buffer));
 }
 template Variable concat_bins<Variable>(const Variable &, const Dim);
 template Variable concat_bins<DataArray>(const Variable &, const Dim);
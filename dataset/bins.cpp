@@ -3,6 +3,9 @@
 /// @file
 /// @author Simon Heybrock
 #include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <optional>
 
 #include "scipp/common/overloaded.h"
 #include "scipp/core/bucket.h"
@@ -10,9 +13,12 @@
 #include "scipp/core/element/histogram.h"
 #include "scipp/core/except.h"
 #include "scipp/core/histogram.h"
+#include "scipp/core/parallel.h"
+#include "scipp/core/tag_util.h"
 
 #include "scipp/variable/arithmetic.h"
 #include "scipp/variable/bins.h"
+#include "scipp/variable/comparison.h"
 #include "scipp/variable/cumulative.h"
 #include "scipp/variable/reduction.h"
 #include "scipp/variable/shape.h"
@@ -29,6 +35,7 @@
 #include "scipp/dataset/histogram.h"
 #include "scipp/dataset/reduction.h"
 #include "scipp/dataset/shape.h"
+#include "scipp/dataset/take.h"
 
 #include "../variable/operations_common.h"
 #include "bin_common.h"
@@ -143,8 +150,10 @@ Dataset resize_default_init(const Dataset &parent, const Dim dim,
 /// Each bin is represented by a Variable slice. `indices` defines the array of
 /// bins as slices of `buffer` along `dim`.
 Variable make_bins(Variable indices, const Dim dim, DataArray buffer) {
-  expect_valid_bin_indices(indices.data_handle(), dim, buffer.dims());
-  return make_bins_no_validate(std::move(indices), dim, std::move(buffer));
+  const bool monotonic =
+      expect_valid_bin_indices(indices.data_handle(), dim, buffer.dims());
+  return variable::make_bins_impl(std::move(indices), dim, std::move(buffer),
+                                  monotonic);
 }
 
 /// Construct a bin-variable over a data array without index validation.
@@ -153,7 +162,8 @@ Variable make_bins(Variable indices, const Dim dim, DataArray buffer) {
 /// bins is acceptable.
 Variable make_bins_no_validate(Variable indices, const Dim dim,
                                DataArray buffer) {
-  return variable::make_bins_impl(std::move(indices), dim, std::move(buffer));
+  return variable::make_bins_impl(std::move(indices), dim, std::move(buffer),
+                                  false);
 }
 
 /// Construct a bin-variable over a dataset.
@@ -161,8 +171,10 @@ Variable make_bins_no_validate(Variable indices, const Dim dim,
 /// Each bin is represented by a Variable slice. `indices` defines the array of
 /// bins as slices of `buffer` along `dim`.
 Variable make_bins(Variable indices, const Dim dim, Dataset buffer) {
-  expect_valid_bin_indices(indices.data_handle(), dim, buffer.sizes());
-  return make_bins_no_validate(std::move(indices), dim, std::move(buffer));
+  const bool monotonic =
+      expect_valid_bin_indices(indices.data_handle(), dim, buffer.sizes());
+  return variable::make_bins_impl(std::move(indices), dim, std::move(buffer),
+                                  monotonic);
 }
 
 /// Construct a bin-variable over a dataset without index validation.
@@ -171,7 +183,8 @@ Variable make_bins(Variable indices, const Dim dim, Dataset buffer) {
 /// bins is acceptable.
 Variable make_bins_no_validate(Variable indices, const Dim dim,
                                Dataset buffer) {
-  return variable::make_bins_impl(std::move(indices), dim, std::move(buffer));
+  return variable::make_bins_impl(std::move(indices), dim, std::move(buffer),
+                                  false);
 }
 
 namespace {
@@ -294,6 +307,353 @@ void append(DataArray &a, const DataArray &b) {
   a.setData(data);
 }
 
+namespace {
+template <class T> Variable capacity_impl(const Variable &var) {
+  const auto &[indices, dim, buffer] = var.constituents<T>();
+  // Unless the buffer was allocated for `var` with spare capacity, the space
+  // between bins may be referenced by other variables sharing the buffer.
+  if (!variable::has_reserved_capacity(var)) {
+    const auto [begin, end] = unzip(indices);
+    return end - begin;
+  }
+  Variable capacity = makeVariable<scipp::index>(indices.dims());
+  const auto ranges = indices.template values<scipp::index_pair>().as_span();
+  const auto out = capacity.values<scipp::index>().as_span();
+  const auto size = scipp::size(ranges);
+  const auto buffer_size = buffer.dims()[dim];
+  core::parallel::parallel_for(
+      core::parallel::blocked_range(0, size), [&](const auto &range) {
+        for (auto i = range.begin(); i != range.end(); ++i)
+          out[i] = (i + 1 < size ? ranges[i + 1].first : buffer_size) -
+                   ranges[i].first;
+      });
+  return capacity;
+}
+
+template <class T> void reserve_impl(Variable &var, const Variable &capacity) {
+  const auto &[indices, dim, buffer] = var.constituents<T>();
+  const auto [begin, end] = unzip(indices);
+  const auto sizes = end - begin;
+  auto out =
+      variable::resize(var, where(less(capacity, sizes), sizes, capacity));
+  auto out_indices = out.bin_indices();
+  const auto out_begin = unzip(out_indices).first;
+  const auto out_end = out_begin + sizes;
+  copy_slices(buffer, out.template bin_buffer<T>(), dim, indices,
+              zip(out_begin, out_end));
+  copy(zip(out_begin, out_end), out_indices);
+  variable::set_reserved_capacity(out);
+  var.setDataHandle(out.data_handle());
+}
+
+template <class T>
+void append_events_impl(Variable &var, const Variable &events) {
+  core::expect::equals(var.dims(), events.dims());
+  const Dim dim = std::get<1>(var.constituents<T>());
+  const auto &[indices1, dim1, buffer1] = events.constituents<T>();
+  static_cast<void>(dim1);
+  const auto [begin1, end1] = unzip(indices1);
+  const auto sizes1 = end1 - begin1;
+  {
+    const auto [begin0, end0] = unzip(var.bin_indices());
+    const auto capacity = capacity_impl<T>(var);
+    const auto required = end0 - begin0 + sizes1;
+    // Reallocation copies the entire buffer, so when any bin overflows every
+    // bin is given slack proportional to its size, i.e., the total capacity
+    // grows geometrically. Empty bins get a minimum capacity, since doubling
+    // does not grow them.
+    if (any(greater(required, capacity)).template value<bool>()) {
+      const auto min_slack = scipp::index{8} * units::one;
+      const auto slack =
+          where(greater(required, min_slack), required, min_slack);
+      const auto grown = required + slack;
+      reserve_impl<T>(var, where(greater(grown, capacity), grown, capacity));
+    }
+  }
+  // Writing the buffer discards the reservation, restore it afterwards.
+  const bool reserved = variable::has_reserved_capacity(var);
+  auto indices0 = var.bin_indices();
+  const auto [begin0, end0] = unzip(indices0);
+  const auto new_end = end0 + sizes1;
+  // Scatter new events directly into free slots at the end of each bin.
+  copy_slices(buffer1, var.bin_buffer<T>(), dim, indices1,
+              zip(end0, new_end));
+  copy(zip(begin0, new_end), indices0);
+  if (reserved)
+    variable::set_reserved_capacity(var);
+}
+
+/// Return the range of the buffer covered by the bins if the bins (in order of
+/// iteration) are adjacent to each other without gaps.
+std::optional<std::pair<scipp::index, scipp::index>>
+contiguous_range(const Variable &indices) {
+  const auto ranges = indices.values<scipp::index_pair>();
+  if (ranges.size() == 0)
+    return std::pair{scipp::index{0}, scipp::index{0}};
+  auto it = ranges.begin();
+  const scipp::index begin = it->first;
+  scipp::index end = begin;
+  for (; it != ranges.end(); ++it) {
+    if (it->first != end || it->second < it->first)
+      return std::nullopt;
+    end = it->second;
+  }
+  return std::pair{begin, end};
+}
+
+template <class T> bool is_compact_impl(const Variable &var) {
+  const auto &[indices, dim, buffer] = var.constituents<T>();
+  return contiguous_range(indices) ==
+         std::pair{scipp::index{0}, buffer.dims()[dim]};
+}
+
+template <class T> double fill_ratio_impl(const Variable &var) {
+  const auto &[indices, dim, buffer] = var.constituents<T>();
+  const auto size = buffer.dims()[dim];
+  if (size == 0)
+    return 1.0;
+  scipp::index referenced = 0;
+  for (const auto &[begin, end] : indices.template values<scipp::index_pair>())
+    referenced += end - begin;
+  return static_cast<double>(referenced) / static_cast<double>(size);
+}
+
+template <class T> Variable compact_impl(const Variable &var) {
+  const auto &[indices, dim, buffer] = var.constituents<T>();
+  if (const auto range = contiguous_range(indices)) {
+    const auto [begin, end] = *range;
+    if (begin == 0 && end == buffer.dims()[dim])
+      return var;
+    // Bins cover a contiguous range of the buffer, e.g., for a slice of
+    // contiguous binned data. Compaction does not require a copy.
+    const auto offset = begin * units::one;
+    const auto [bin_begin, bin_end] = unzip(indices);
+    return make_bins_no_validate(zip(bin_begin - offset, bin_end - offset),
+                                 dim, buffer.slice({dim, begin, end}));
+  }
+  // `copy` uses `empty_like` which creates a contiguous layout covering only
+  // the referenced elements of the buffer. Bins are copied in parallel.
+  return copy(var);
+}
+
+/// Strict weak ordering placing NaN values after all other values.
+template <class T> bool sort_less(const T &a, const T &b) {
+  if constexpr (std::is_floating_point_v<T>)
+    return !std::isnan(a) && (std::isnan(b) || a < b);
+  else
+    return a < b;
+}
+
+/// Sort the events of every bin by `key`, writing buffer indices to `perm`.
+///
+/// Bins are split into parts with approximately equal event counts, such that
+/// a few large bins do not serialize the work. Bins that are sorted already are
+/// only checked. Returns true if any bin was not sorted.
+template <class T> struct SortBins {
+  static bool apply(const Variable &key, const SortOrder order,
+                    const std::vector<scipp::index_pair> &ranges,
+                    const std::vector<scipp::index> &offsets,
+                    std::vector<scipp::index> &perm) {
+    const auto values = key.values<T>().as_span();
+    const auto less = [&](const scipp::index a, const scipp::index b) {
+      return order == SortOrder::Ascending ? sort_less(values[a], values[b])
+                                           : sort_less(values[b], values[a]);
+    };
+    constexpr scipp::index part_size = 1 << 14;
+    const auto nbin = scipp::size(ranges);
+    const auto total = offsets.back();
+    const auto nparts = std::clamp(total / part_size, scipp::index(1),
+                                   std::max(nbin, scipp::index(1)));
+    std::vector<char> unsorted(nparts, false);
+    const auto first_bin = [&](const scipp::index part) {
+      return std::upper_bound(offsets.begin(), offsets.end() - 1,
+                              part * total / nparts - 1) -
+             offsets.begin();
+    };
+    core::parallel::parallel_for(
+        core::parallel::blocked_range(0, nparts, 1), [&](const auto &range) {
+          for (auto part = range.begin(); part != range.end(); ++part) {
+            const auto end = part + 1 == nparts ? nbin : first_bin(part + 1);
+            for (auto bin = part == 0 ? 0 : first_bin(part); bin < end; ++bin) {
+              const auto out = perm.begin() + offsets[bin];
+              const auto out_end = perm.begin() + offsets[bin + 1];
+              std::iota(out, out_end, ranges[bin].first);
+              if (!std::is_sorted(out, out_end, less)) {
+                std::stable_sort(out, out_end, less);
+                unsorted[part] = true;
+              }
+            }
+          }
+        });
+    return std::find(unsorted.begin(), unsorted.end(), true) != unsorted.end();
+  }
+};
+
+template <class T>
+Variable sort_impl(const Variable &var, const Dim key, const SortOrder order) {
+  const auto &[indices, dim, buffer] = var.constituents<T>();
+  const auto &coord = buffer.coords()[key];
+  if (coord.dims() != Dimensions{dim, buffer.dims()[dim]})
+    throw except::DimensionError("Sort key of bins must be 1-dimensional "
+                                 "along the bin dimension.");
+  if (coord.hasVariances())
+    throw except::VariancesError("Sort key cannot have variances.");
+  const auto contiguous = coord.strides()[0] == 1 ? coord : copy(coord);
+  const auto view = indices.template values<scipp::index_pair>();
+  const std::vector<scipp::index_pair> ranges(view.begin(), view.end());
+  std::vector<scipp::index> offsets(ranges.size() + 1, 0);
+  for (size_t i = 0; i < ranges.size(); ++i)
+    offsets[i + 1] = offsets[i] + (ranges[i].second - ranges[i].first);
+  std::vector<scipp::index> perm(offsets.back());
+  const bool unsorted =
+      core::CallDType<double, float, int64_t, int32_t, std::string,
+                      core::time_point>::apply<SortBins>(contiguous.dtype(),
+                                                         contiguous, order,
+                                                         ranges, offsets,
+                                                         perm);
+  if (!unsorted)
+    return var;
+  std::vector<scipp::index_pair> out_ranges(ranges.size());
+  for (size_t i = 0; i < ranges.size(); ++i)
+    out_ranges[i] = {offsets[i], offsets[i + 1]};
+  return make_bins_no_validate(
+      makeVariable<scipp::index_pair>(indices.dims(),
+                                      Values(std::move(out_ranges))),
+      dim,
+      take(buffer, makeVariable<scipp::index>(Dims{dim}, Shape{offsets.back()},
+                                              Values(std::move(perm))),
+           dim));
+}
+} // namespace
+
+/// Return the capacity of each bin.
+///
+/// The capacity is the number of elements a bin can hold before `append_events`
+/// has to reallocate the buffer. If the buffer was allocated with spare
+/// capacity by `reserve`, `append_events`, or `resize(var, shape)`, free slots
+/// between the end of a bin and the begin of the next bin are available for
+/// growing the bin. Otherwise, e.g., for a slice, or if the buffer may be
+/// shared with other variables, the capacity is equal to the bin sizes.
+Variable capacity(const Variable &var) {
+  if (var.dtype() == dtype<bucket<Variable>>)
+    return capacity_impl<Variable>(var);
+  else if (var.dtype() == dtype<bucket<DataArray>>)
+    return capacity_impl<DataArray>(var);
+  else
+    return capacity_impl<Dataset>(var);
+}
+
+/// Reallocate the buffer of binned data such that each bin has at least the
+/// given capacity.
+///
+/// This uses the reserve semantics of `resize(var, shape)`. Existing bin
+/// contents are preserved. Capacities smaller than the current bin sizes are
+/// ignored.
+void reserve(Variable &var, const Variable &capacity) {
+  if (var.dtype() == dtype<bucket<Variable>>)
+    reserve_impl<Variable>(var, capacity);
+  else if (var.dtype() == dtype<bucket<DataArray>>)
+    reserve_impl<DataArray>(var, capacity);
+  else
+    reserve_impl<Dataset>(var, capacity);
+}
+
+/// Append the contents of the bins of `events` to the corresponding bins of
+/// `var`.
+///
+/// Unlike `append`, this writes new events directly into free slots of the
+/// bins of `var` (see `capacity`) without copying existing events. If any bin
+/// overflows its capacity the entire buffer is reallocated, giving every bin a
+/// capacity of `size + max(size, 8)`, where `size` is its new size, unless its
+/// current capacity is larger. If new events are distributed over bins roughly
+/// like the existing events, repeatedly appending chunks therefore has
+/// amortized cost proportional to the number of new events. If
+/// they are concentrated in few bins, every overflow still copies all events,
+/// but the number of reallocations is logarithmic in the growth of each bin.
+///
+/// Free slots are used only if they were reserved for `var`, see `capacity`,
+/// so bins of other variables sharing the buffer are never overwritten.
+void append_events(Variable &var, const Variable &events) {
+  if (var.dtype() == dtype<bucket<Variable>>)
+    append_events_impl<Variable>(var, events);
+  else if (var.dtype() == dtype<bucket<DataArray>>)
+    append_events_impl<DataArray>(var, events);
+  else
+    append_events_impl<Dataset>(var, events);
+}
+
+void append_events(DataArray &a, const DataArray &events) {
+  expect::coordsAreSuperset(a, events);
+  union_or_in_place(a.masks(), events.masks());
+  auto data = a.data();
+  append_events(data, events.data());
+  a.setData(data);
+}
+
+/// Return binned data with contiguous bins and no spare capacity.
+///
+/// Only the elements referenced by the bins are copied, in bin order. Returns a
+/// shallow copy if `var` is already compact. If the bins cover a contiguous
+/// range of the buffer, e.g., for a slice of compact binned data, the result
+/// references a slice of the original buffer and no copy is made.
+Variable compact(const Variable &var) {
+  if (var.dtype() == dtype<bucket<Variable>>)
+    return compact_impl<Variable>(var);
+  else if (var.dtype() == dtype<bucket<DataArray>>)
+    return compact_impl<DataArray>(var);
+  else
+    return compact_impl<Dataset>(var);
+}
+
+DataArray compact(const DataArray &array) {
+  return {compact(array.data()), array.coords(), array.masks(),
+          array.attrs(), array.name()};
+}
+
+/// Return binned data with the events of every bin sorted by the coord `key`.
+///
+/// All columns of the bin buffer are permuted consistently, in a single pass.
+/// The sort is stable and places NaN values at the end for ascending order and
+/// at the beginning for descending order. The output is compact, unless all
+/// bins are sorted already, in which case a shallow copy of `var` is returned.
+Variable sort(const Variable &var, const Dim key, const SortOrder order) {
+  if (var.dtype() == dtype<bucket<DataArray>>)
+    return sort_impl<DataArray>(var, key, order);
+  else if (var.dtype() == dtype<bucket<Dataset>>)
+    return sort_impl<Dataset>(var, key, order);
+  else
+    throw except::TypeError("Sorting bins by a coordinate requires bins with "
+                            "a DataArray or Dataset buffer.");
+}
+
+DataArray sort(const DataArray &array, const Dim key, const SortOrder order) {
+  return {sort(array.data(), key, order), array.coords(), array.masks(),
+          array.attrs(), array.name()};
+}
+
+/// Return true if the bins of `var` are contiguous and cover the entire buffer.
+bool is_compact(const Variable &var) {
+  if (var.dtype() == dtype<bucket<Variable>>)
+    return is_compact_impl<Variable>(var);
+  else if (var.dtype() == dtype<bucket<DataArray>>)
+    return is_compact_impl<DataArray>(var);
+  else
+    return is_compact_impl<Dataset>(var);
+}
+
+/// Return the fraction of the buffer of `var` that is referenced by its bins.
+///
+/// Values less than 1 indicate unreferenced gaps in the buffer, e.g., from
+/// slicing or spare capacity, which can be removed using `compact`.
+double fill_ratio(const Variable &var) {
+  if (var.dtype() == dtype<bucket<Variable>>)
+    return fill_ratio_impl<Variable>(var);
+  else if (var.dtype() == dtype<bucket<DataArray>>)
+    return fill_ratio_impl<DataArray>(var);
+  else
+    return fill_ratio_impl<Dataset>(var);
+}
+
 Variable histogram(const Variable &data, const Variable &binEdges) {
   using namespace scipp::core;
   auto hist_dim = binEdges.dims().inner();
@@ -363,11 +723,16 @@ void scale(DataArray &array, const DataArray &histogram, Dim dim) {
 }
 
 namespace {
-Variable applyMask(const DataArray &buffer, const Variable &indices,
-                   const Dim dim, const Variable &mask) {
-  return make_bins(
-      indices, dim,
-      where(mask, Variable(buffer.data(), Dimensions{}), buffer.data()));
+Variable applyMask(const Variable &data, const DataArray &buffer,
+                   const Variable &indices, const Dim dim,
+                   const Variable &mask) {
+  auto masked =
+      where(mask, Variable(buffer.data(), Dimensions{}), buffer.data());
+  // The masked buffer has the same size, so indices validated for the buffer
+  // of `data` need not be validated again.
+  if (variable::has_validated_bin_indices(data))
+    return variable::make_bins_impl(indices, dim, std::move(masked), true);
+  return make_bins(indices, dim, std::move(masked));
 }
 
 } // namespace
@@ -386,7 +751,8 @@ Variable sum(const Variable &data) {
     const auto &&[indices, dim, buffer] = data.constituents<DataArray>();
     if (const auto mask_union = irreducible_mask(buffer.masks(), dim);
         mask_union.is_valid()) {
-      variable::sum_impl(summed, applyMask(buffer, indices, dim, mask_union));
+      variable::sum_impl(summed,
+                         applyMask(data, buffer, indices, dim, mask_union));
     } else {
       variable::sum_impl(summed, data);
     }
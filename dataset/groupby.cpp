@@ -2,16 +2,22 @@
 // Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
 /// @file
 /// @author Simon Heybrock
+#include <algorithm>
 #include <numeric>
+#include <tuple>
+#include <unordered_map>
 
 #include "scipp/common/numeric.h"
 
 #include "scipp/core/bucket.h"
+#include "scipp/core/element/segmented_reduction.h"
 #include "scipp/core/histogram.h"
 #include "scipp/core/parallel.h"
 #include "scipp/core/tag_util.h"
 
 #include "scipp/variable/operations.h"
+#include "scipp/variable/subspan_view.h"
+#include "scipp/variable/transform.h"
 #include "scipp/variable/util.h"
 
 #include "scipp/dataset/bins.h"
@@ -40,7 +46,7 @@ auto copy_impl(const Slices &slices, const Data &data, const Dim dim,
   const Dim slice_dim = data.coords()[dim].dims().inner();
   auto out = dataset::copy(data.slice({slice_dim, 0, size}), attrPolicy);
   scipp::index current = 0;
-  auto out_slices = slices;
+  std::vector<Slice> out_slices(slices.begin(), slices.end());
   for (auto &slice : out_slices) {
     const auto thickness = slice.end() - slice.begin();
     slice = Slice(slice.dim(), current, current + thickness);
@@ -91,13 +97,115 @@ T GroupBy<T>::makeReductionOutput(const Dim reductionDim,
 }
 
 namespace {
-template <class Op, class Groups>
-void reduce_(Op op, const Dim reductionDim, const Variable &out_data,
-             const DataArray &data, const Dim dim, const Groups &groups,
-             const FillValue fill) {
-  const auto mask_replacement =
-      special_like(Variable(data.data(), Dimensions{}), fill);
+/// Return the index of the group of every position along `dim`, or -1 for
+/// positions that are not part of any group.
+Variable make_group_index(const GroupSlices &groups, const Dim dim,
+                          const scipp::index size) {
+  auto index = makeVariable<scipp::index>(Dims{dim}, Shape{size});
+  const auto values = index.values<scipp::index>();
+  std::fill(values.begin(), values.end(), -1);
+  const auto fill = [&](const auto &range) {
+    for (scipp::index group = range.begin(); group != range.end(); ++group)
+      for (const auto &slice : groups[group])
+        std::fill(values.begin() + slice.begin(), values.begin() + slice.end(),
+                  group);
+  };
+  core::parallel::parallel_for(core::parallel::blocked_range(0, groups.size()),
+                               fill);
+  return index;
+}
+
+bool is_inner_contiguous(const Variable &var, const Dim dim) {
+  return var.dims().contains(dim) && var.dims().inner() == dim &&
+         var.strides()[var.dims().index(dim)] == 1;
+}
+
+/// Return true if groups should be reduced in a single pass over the data.
+///
+/// Reducing slice by slice has a significant overhead per slice, so this is
+/// preferred if the groups consist of many thin slices, e.g., when the key is
+/// interleaved. Only dense data with a mask (if any) that depends solely on the
+/// reduction dimension is supported.
+bool use_segmented_reduce(const GroupSlices &groups, const Dim reductionDim,
+                          const Variable &out_data, const DataArray &data,
+                          const Dim dim, const Variable &mask) {
+  constexpr scipp::index max_average_thickness = 16;
+  const auto &var = data.data();
+  if (is_bins(var) || !is_inner_contiguous(var, reductionDim) ||
+      !is_inner_contiguous(out_data, dim))
+    return false;
+  const auto type = var.dtype();
+  if (type != out_data.dtype() ||
+      var.hasVariances() != out_data.hasVariances() ||
+      !(type == dtype<double> || type == dtype<float> ||
+        type == dtype<int64_t> || type == dtype<int32_t> ||
+        type == dtype<bool>))
+    return false;
+  const auto &slices = groups.slices();
+  if (slices.empty() ||
+      scipp::size(slices) * max_average_thickness < var.dims()[reductionDim])
+    return false;
+  if (std::any_of(slices.begin(), slices.end(), [&](const auto &slice) {
+        return slice.dim() != reductionDim;
+      }))
+    return false;
+  return !mask.is_valid() ||
+         mask.dims() == Dimensions(reductionDim, var.dims()[reductionDim]);
+}
+
+/// Reduce all groups with a single segmented pass over the data.
+///
+/// If the input is much larger than the output the input is split into chunks
+/// that are reduced independently and combined afterwards.
+template <class Op, class Kernel>
+void reduce_segmented(Op op, Kernel kernel, const Dim reductionDim,
+                      Variable out_data, const Variable &data, const Dim dim,
+                      const Variable &group_index) {
+  constexpr scipp::index min_chunk_volume = 65536;
+  constexpr scipp::index max_chunks = 64;
+  const auto length = data.dims()[reductionDim];
+  const auto nchunk = std::clamp(
+      data.dims().volume() / std::max(4 * out_data.dims().volume(),
+                                      min_chunk_volume),
+      scipp::index{1}, std::min(length, max_chunks));
+  // Chunk outputs are initialized by copying the output before any data is
+  // reduced into it, i.e., they hold the reduction's identity.
+  std::vector<Variable> partials(nchunk);
+  for (scipp::index chunk = 1; chunk < nchunk; ++chunk)
+    partials[chunk] = variable::copy(out_data);
+  partials[0] = out_data;
+  const auto process = [&](const auto &range) {
+    for (scipp::index chunk = range.begin(); chunk != range.end(); ++chunk) {
+      const Slice slice(reductionDim, length * chunk / nchunk,
+                        length * (chunk + 1) / nchunk);
+      transform_in_place(subspan_view(partials[chunk], dim),
+                         subspan_view(data.slice(slice), reductionDim),
+                         subspan_view(group_index.slice(slice), reductionDim),
+                         kernel, "groupby.reduce");
+    }
+  };
+  core::parallel::parallel_for(core::parallel::blocked_range(0, nchunk, 1),
+                               process);
+  for (scipp::index chunk = 1; chunk < nchunk; ++chunk)
+    op(out_data, partials[chunk]);
+}
+
+template <class Op, class Kernel>
+void reduce_(Op op, Kernel kernel, const Dim reductionDim,
+             const Variable &out_data, const DataArray &data, const Dim dim,
+             const GroupSlices &groups, Variable &group_index) {
   auto mask = irreducible_mask(data.masks(), reductionDim);
+  if (use_segmented_reduce(groups, reductionDim, out_data, data, dim, mask)) {
+    if (!group_index.is_valid())
+      group_index = make_group_index(groups, reductionDim,
+                                     data.dims()[reductionDim]);
+    const auto index =
+        mask.is_valid()
+            ? where(mask, makeVariable<scipp::index>(Values{-1}), group_index)
+            : group_index;
+    return reduce_segmented(op, kernel, reductionDim, out_data,
+                            data.data(), dim, index);
+  }
   const auto process = [&](const auto &range) {
     // Apply to each group, storing result in output slice
     for (scipp::index group = range.begin(); group != range.end(); ++group) {
@@ -105,7 +213,7 @@ void reduce_(Op op, const Dim reductionDim, const Variable &out_data,
       for (const auto &slice : groups[group]) {
         const auto data_slice = data.data().slice(slice);
         if (mask.is_valid())
-          op(out_slice, where(mask.slice(slice), mask_replacement, data_slice));
+          op(out_slice, data_slice, mask.slice(slice));
         else
           op(out_slice, data_slice);
       }
@@ -117,16 +225,19 @@ void reduce_(Op op, const Dim reductionDim, const Variable &out_data,
 } // namespace
 
 template <class T>
-template <class Op>
-T GroupBy<T>::reduce(Op op, const Dim reductionDim,
+template <class Op, class Kernel>
+T GroupBy<T>::reduce(Op op, Kernel kernel, const Dim reductionDim,
                      const FillValue fill) const {
   auto out = makeReductionOutput(reductionDim, fill);
+  // Shared by all items since they have identical groups
+  Variable group_index;
   if constexpr (std::is_same_v<T, Dataset>) {
     for (const auto &item : m_data)
-      reduce_(op, reductionDim, out[item.name()].data(), item, dim(), groups(),
-              fill);
+      reduce_(op, kernel, reductionDim, out[item.name()].data(), item,
+              dim(), groups(), group_index);
   } else {
-    reduce_(op, reductionDim, out.data(), m_data, dim(), groups(), fill);
+    reduce_(op, kernel, reductionDim, out.data(), m_data, dim(), groups(),
+            group_index);
   }
   return out;
 }
@@ -150,38 +261,43 @@ template <class T> T GroupBy<T>::concatenate(const Dim reductionDim) const {
 
 /// Reduce each group using `sum` and return combined data.
 template <class T> T GroupBy<T>::sum(const Dim reductionDim) const {
-  return reduce(sum_impl, reductionDim, FillValue::ZeroNotBool);
+  return reduce([](auto &&... _) { sum_impl(_...); },
+                core::element::segmented_sum, reductionDim,
+                FillValue::ZeroNotBool);
 }
 
 /// Reduce each group using `all` and return combined data.
 template <class T> T GroupBy<T>::all(const Dim reductionDim) const {
-  return reduce(all_impl, reductionDim, FillValue::True);
+  return reduce([](auto &&... _) { all_impl(_...); },
+                core::element::segmented_all, reductionDim, FillValue::True);
 }
 
 /// Reduce each group using `any` and return combined data.
 template <class T> T GroupBy<T>::any(const Dim reductionDim) const {
-  return reduce(any_impl, reductionDim, FillValue::False);
+  return reduce([](auto &&... _) { any_impl(_...); },
+                core::element::segmented_any, reductionDim, FillValue::False);
 }
 
 /// Reduce each group using `max` and return combined data.
 template <class T> T GroupBy<T>::max(const Dim reductionDim) const {
-  return reduce(max_impl, reductionDim, FillValue::Lowest);
+  return reduce([](auto &&... _) { max_impl(_...); },
+                core::element::segmented_max, reductionDim, FillValue::Lowest);
 }
 
 /// Reduce each group using `min` and return combined data.
 template <class T> T GroupBy<T>::min(const Dim reductionDim) const {
-  return reduce(min_impl, reductionDim, FillValue::Max);
+  return reduce([](auto &&... _) { min_impl(_...); },
+                core::element::segmented_min, reductionDim, FillValue::Max);
 }
 
 /// Combine groups without changes, effectively sorting data.
 template <class T> T GroupBy<T>::copy(const SortOrder order) const {
-  std::vector<Slice> flat;
   if (order == SortOrder::Ascending)
-    for (const auto &slices : groups())
-      flat.insert(flat.end(), slices.begin(), slices.end());
-  else
-    for (auto it = groups().rbegin(); it != groups().rend(); ++it)
-      flat.insert(flat.end(), it->begin(), it->end());
+    return copy_impl(groups().slices(), m_data, dim());
+  std::vector<Slice> flat;
+  flat.reserve(groups().slices().size());
+  for (scipp::index group = size() - 1; group >= 0; --group)
+    flat.insert(flat.end(), groups()[group].begin(), groups()[group].end());
   return copy_impl(flat, m_data, dim());
 }
 
@@ -195,12 +311,22 @@ template <class T> T GroupBy<T>::mean(const Dim reductionDim) const {
     auto scale = makeVariable<double>(Dims{dim()}, Shape{size()});
     const auto scaleT = scale.template values<double>();
     const auto mask = irreducible_mask(data.masks(), reductionDim);
+    // 1-D masks are common, avoid a `sum` call for every slice in that case
+    const auto dense_mask = mask.is_valid() && mask.dims().ndim() == 1
+                                ? variable::copy(mask)
+                                : Variable{};
+    const auto masked = dense_mask.is_valid()
+                            ? dense_mask.template values<bool>()
+                            : scipp::span<const bool>{};
     for (scipp::index group = 0; group < size(); ++group)
       for (const auto &slice : groups()[group]) {
         // N contributing to each slice
         scaleT[group] += slice.end() - slice.begin();
         // N masks for each slice, that need to be subtracted
-        if (mask.is_valid()) {
+        if (!masked.empty()) {
+          scaleT[group] -= std::count(masked.begin() + slice.begin(),
+                                      masked.begin() + slice.end(), true);
+        } else if (mask.is_valid()) {
           const auto masks_sum = variable::sum(mask.slice(slice), reductionDim);
           scaleT[group] -= masks_sum.template value<int64_t>();
         }
@@ -237,43 +363,177 @@ template <class T> struct NanSensitiveLess {
     return a < b;
   }
 };
+
+template <class T> struct NanSensitiveEqual {
+  bool operator()(const T *a, const T *b) const {
+    return *a == *b ||
+           (scipp::numeric::isnan(*a) && scipp::numeric::isnan(*b));
+  }
+};
+
+template <class T> struct NanSensitiveHash {
+  size_t operator()(const T *x) const {
+    if constexpr (std::is_same_v<T, core::time_point>)
+      return std::hash<int64_t>{}(x->time_since_epoch());
+    else
+      return scipp::numeric::isnan(*x) ? 0 : std::hash<T>{}(*x);
+  }
+};
+
+/// Map from key (pointing into the grouped values) to group id.
+template <class T>
+using KeyIds = std::unordered_map<const T *, scipp::index, NanSensitiveHash<T>,
+                                  NanSensitiveEqual<T>>;
+
+/// Runs of equal keys in a chunk of the input.
+template <class T> struct KeyRuns {
+  /// Begin of every run, each run ends at the begin of the next or at `end`.
+  std::vector<scipp::index> begin;
+  scipp::index end;
+  /// Chunk-local id of the key of every run.
+  std::vector<scipp::index> id;
+  /// Unique keys in the chunk, indexed by chunk-local id.
+  std::vector<const T *> unique;
+};
+
+template <class T>
+KeyRuns<T> find_key_runs(const scipp::span<const T> &values,
+                         const scipp::index begin, const scipp::index end) {
+  KeyRuns<T> runs;
+  runs.end = end;
+  KeyIds<T> ids;
+  const NanSensitiveEqual<T> equal;
+  for (scipp::index i = begin; i < end;) {
+    const T *value = &values[i];
+    runs.begin.push_back(i);
+    while (++i < end && equal(value, &values[i])) {
+    }
+    const auto [it, inserted] =
+        ids.try_emplace(value, scipp::size(runs.unique));
+    if (inserted)
+      runs.unique.push_back(value);
+    runs.id.push_back(it->second);
+  }
+  return runs;
+}
+
+/// Store slices of every group contiguously, given runs found in consecutive
+/// chunks of the input.
+///
+/// `group_of` maps the id of a run to its group, runs with a negative group are
+/// skipped. Adjacent runs of the same group, split by chunking, are merged into
+/// a single slice.
+template <class Chunks, class GroupOf>
+GroupSlices make_group_slices(const Chunks &chunks, const GroupOf &group_of,
+                              const scipp::index ngroup, const Dim dim) {
+  const auto for_each_run = [&](auto &&func) {
+    std::vector<scipp::index> last_end(ngroup, -1);
+    for (const auto &chunk : chunks)
+      for (scipp::index run = 0; run < scipp::size(chunk.begin); ++run) {
+        const scipp::index group = group_of(chunk.id[run]);
+        if (group < 0)
+          continue;
+        const auto begin = chunk.begin[run];
+        const auto end = run + 1 < scipp::size(chunk.begin)
+                             ? chunk.begin[run + 1]
+                             : chunk.end;
+        func(group, begin, end, last_end[group] == begin);
+        last_end[group] = end;
+      }
+  };
+  std::vector<scipp::index> offsets(ngroup + 1, 0);
+  for_each_run([&](const auto group, auto, auto, const bool merge) {
+    offsets[group + 1] += merge ? 0 : 1;
+  });
+  std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+  std::vector<Slice> slices(offsets.back());
+  auto current = offsets;
+  for_each_run([&](const auto group, const auto begin, const auto end,
+                   const bool merge) {
+    if (merge)
+      slices[current[group] - 1] =
+          Slice(dim, slices[current[group] - 1].begin(), end);
+    else
+      slices[current[group]++] = Slice(dim, begin, end);
+  });
+  return {std::move(slices), std::move(offsets)};
+}
 } // namespace
 
 template <class T> struct MakeGroups {
   static auto apply(const Variable &key, const Dim targetDim) {
     expect::isKey(key);
-    const auto &values = key.values<T>();
-
+    const auto contiguous = key.strides()[0] == 1 ? key : copy(key);
+    const auto values = contiguous.values<T>().as_span();
+    const auto size = scipp::size(values);
     const auto dim = key.dims().inner();
-    std::map<T, GroupByGrouping::group, NanSensitiveLess<T>> indices;
-    const auto end = values.end();
-    scipp::index i = 0;
-    for (auto it = values.begin(); it != end;) {
-      // Use contiguous (thick) slices if possible to avoid overhead of slice
-      // handling in follow-up "apply" steps.
-      const auto begin = i;
-      const auto &value = *it;
-      while (it != end && (*it == value || (scipp::numeric::isnan(value) &&
-                                            scipp::numeric::isnan(*it)))) {
-        ++it;
-        ++i;
+
+    // 1. Find runs of equal keys and hash them, in parallel for every chunk.
+    constexpr scipp::index min_chunk_size = 1 << 20;
+    constexpr scipp::index max_chunks = 64;
+    const auto nchunk =
+        std::clamp(size / min_chunk_size, scipp::index(1), max_chunks);
+    std::vector<KeyRuns<T>> chunks(nchunk);
+    core::parallel::parallel_for(
+        core::parallel::blocked_range(0, nchunk, 1), [&](const auto &range) {
+          for (scipp::index c = range.begin(); c != range.end(); ++c)
+            chunks[c] = find_key_runs(values, c * size / nchunk,
+                                      (c + 1) * size / nchunk);
+        });
+
+    // 2. Merge chunk-local ids into global ids.
+    KeyIds<T> ids;
+    std::vector<const T *> unique;
+    for (auto &chunk : chunks) {
+      std::vector<scipp::index> global(chunk.unique.size());
+      for (scipp::index i = 0; i < scipp::size(chunk.unique); ++i) {
+        const auto [it, inserted] =
+            ids.try_emplace(chunk.unique[i], scipp::size(unique));
+        if (inserted)
+          unique.push_back(chunk.unique[i]);
+        global[i] = it->second;
       }
-      indices[value].emplace_back(dim, begin, i);
+      for (auto &id : chunk.id)
+        id = global[id];
     }
 
-    const Dimensions dims{targetDim, scipp::size(indices)};
+    // 3. Sort only the unique keys, group index is the rank of the key.
+    std::vector<scipp::index> order(unique.size());
+    std::iota(order.begin(), order.end(), 0);
+    const NanSensitiveLess<T> less;
+    core::parallel::parallel_sort(order.begin(), order.end(),
+                                  [&](const auto a, const auto b) {
+                                    return less(*unique[a], *unique[b]);
+                                  });
+    std::vector<scipp::index> rank(order.size());
+    for (scipp::index i = 0; i < scipp::size(order); ++i)
+      rank[order[i]] = i;
+
+    // 4. Store slices of every group contiguously.
+    const auto ngroup = scipp::size(unique);
+    auto groups = make_group_slices(
+        chunks, [&](const auto id) { return rank[id]; }, ngroup, dim);
+
     std::vector<T> keys;
-    std::vector<GroupByGrouping::group> groups;
-    for (auto &item : indices) {
-      keys.emplace_back(std::move(item.first));
-      groups.emplace_back(std::move(item.second));
-    }
-    auto keys_ = makeVariable<T>(Dimensions{dims}, Values(std::move(keys)));
+    keys.reserve(ngroup);
+    for (const auto i : order)
+      keys.emplace_back(*unique[i]);
+    auto keys_ = makeVariable<T>(Dimensions{targetDim, ngroup},
+                                 Values(std::move(keys)));
     keys_.setUnit(key.unit());
     return GroupByGrouping{std::move(keys_), std::move(groups)};
   }
 };
 
+/// Runs of positions in the same bin in a chunk of the input.
+struct BinRuns {
+  /// Begin of every run, each run ends at the begin of the next or at `end`.
+  std::vector<scipp::index> begin;
+  scipp::index end;
+  /// Bin of every run, -1 if outside the bin edges.
+  std::vector<scipp::index> id;
+};
+
 template <class T> struct MakeBinGroups {
   static auto apply(const Variable &key, const Variable &bins) {
     expect::isKey(key);
@@ -281,27 +541,74 @@ template <class T> struct MakeBinGroups {
       throw except::DimensionError("Group-by bins must be 1-dimensional");
     if (key.unit() != bins.unit())
       throw except::UnitError("Group-by key must have same unit as bins");
-    const auto &values = key.values<T>();
-    const auto &edges = bins.values<T>();
+    const auto contiguous = key.strides()[0] == 1 ? key : copy(key);
+    const auto values = contiguous.values<T>().as_span();
+    const auto contiguous_edges = bins.strides()[0] == 1 ? bins : copy(bins);
+    const auto edges = contiguous_edges.values<T>().as_span();
     core::expect::histogram::sorted_edges(edges);
-
+    const auto size = scipp::size(values);
+    const auto nbin = scipp::size(edges) - 1;
     const auto dim = key.dims().inner();
-    std::vector<GroupByGrouping::group> groups(edges.size() - 1);
-    for (scipp::index i = 0; i < scipp::size(values);) {
-      // Use contiguous (thick) slices if possible to avoid overhead of slice
-      // handling in follow-up "apply" steps.
-      const auto value = values[i];
-      const auto begin = i++;
-      auto right = std::upper_bound(edges.begin(), edges.end(), value);
-      if (right != edges.end() && right != edges.begin()) {
-        auto left = right - 1;
-        while (i < scipp::size(values) && (*left <= values[i]) &&
-               (values[i] < *right))
-          ++i;
-        groups[std::distance(edges.begin(), left)].emplace_back(dim, begin, i);
+
+    const auto in_bin = [&](const T &x, const scipp::index bin) {
+      return edges[bin] <= x && x < edges[bin + 1];
+    };
+    // Constant bin width allows for computing the bin directly. The result is
+    // checked against the neighboring edges to guard against rounding errors.
+    const bool linspace = numeric::islinspace(edges);
+    const auto params = linspace ? core::linear_edge_params(edges)
+                                 : std::tuple{T{}, scipp::index{0}, 0.0};
+    const auto bin_of = [&](const T &x) -> scipp::index {
+      if (linspace) {
+        const auto [offset, nbins, scale] = params;
+        const double pos = (x - offset) * scale;
+        if (!(pos >= -1.0 && pos < static_cast<double>(nbins + 1)))
+          return -1;
+        const auto bin =
+            std::clamp(static_cast<scipp::index>(pos), scipp::index{0},
+                       nbin - 1);
+        for (const auto candidate : {bin, bin - 1, bin + 1})
+          if (candidate >= 0 && candidate < nbin && in_bin(x, candidate))
+            return candidate;
+        return -1;
       }
-    }
-    return GroupByGrouping{bins, std::move(groups)};
+      const auto right = std::upper_bound(edges.begin(), edges.end(), x);
+      return (right == edges.begin() || right == edges.end())
+                 ? -1
+                 : std::distance(edges.begin(), right) - 1;
+    };
+
+    // 1. Find runs of positions in the same bin, in parallel for every chunk.
+    // Runs are used to obtain contiguous (thick) slices if possible, avoiding
+    // overhead of slice handling in follow-up "apply" steps.
+    constexpr scipp::index min_chunk_size = 1 << 20;
+    constexpr scipp::index max_chunks = 64;
+    const auto nchunk =
+        std::clamp(size / min_chunk_size, scipp::index(1), max_chunks);
+    std::vector<BinRuns> chunks(nchunk);
+    core::parallel::parallel_for(
+        core::parallel::blocked_range(0, nchunk, 1), [&](const auto &range) {
+          for (scipp::index c = range.begin(); c != range.end(); ++c) {
+            auto &runs = chunks[c];
+            runs.end = (c + 1) * size / nchunk;
+            for (scipp::index i = c * size / nchunk; i < runs.end;) {
+              const auto bin = bin_of(values[i]);
+              runs.begin.push_back(i);
+              runs.id.push_back(bin);
+              if (bin < 0)
+                while (++i < runs.end && bin_of(values[i]) < 0) {
+                }
+              else
+                while (++i < runs.end && in_bin(values[i], bin)) {
+                }
+            }
+          }
+        });
+
+    // 2. Store slices of every group contiguously.
+    return GroupByGrouping{
+        bins, make_group_slices(
+                  chunks, [](const auto id) { return id; }, nbin, dim)};
   }
 };
 
@@ -394,6 +701,18 @@ GroupBy<Dataset> groupby(const Dataset &dataset, const Variable &key,
   throw except::DimensionError("Size of Group-by key is incorrect.");
 }
 
+GroupByGrouping::GroupByGrouping(Variable key,
+                                 const std::vector<group> &groups)
+    : m_key(std::move(key)) {
+  std::vector<scipp::index> offsets{0};
+  std::vector<Slice> slices;
+  for (const auto &slices_ : groups) {
+    slices.insert(slices.end(), slices_.begin(), slices_.end());
+    offsets.push_back(scipp::size(slices));
+  }
+  m_groups = GroupSlices(std::move(slices), std::move(offsets));
+}
+
 template class GroupBy<DataArray>;
 template class GroupBy<Dataset>;
 
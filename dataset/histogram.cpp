@@ -57,17 +57,30 @@ DataArray histogram(const DataArray &events, const Variable &binEdges) {
         events,
         [dim](const DataArray &events_, const Dim event_dim_,
               const Variable &binEdges_) {
-          const auto data = masked_data(events_, event_dim_);
           // Warning: Don't try to move the `as_contiguous` into `subspan_view`
           // without special care: It may return a new variable which will go
           // out of scope, leading to subtle bugs. Here on the other hand the
           // returned temporary is kept alive until the end of the
           // full-expression.
+          const auto nbin = binEdges_.dims()[dim] - 1;
+          // Masked events are skipped by the kernel, no need to copy data.
+          if (const auto mask = irreducible_mask(events_.masks(), event_dim_);
+              mask.is_valid())
+            return transform_subspan(
+                events_.dtype(), dim, nbin,
+                subspan_view(as_contiguous(events_.coords()[dim], event_dim_),
+                             event_dim_),
+                subspan_view(as_contiguous(events_.data(), event_dim_),
+                             event_dim_),
+                binEdges_,
+                subspan_view(as_contiguous(mask, event_dim_), event_dim_),
+                element::histogram_masked, "histogram");
           return transform_subspan(
-              events_.dtype(), dim, binEdges_.dims()[dim] - 1,
+              events_.dtype(), dim, nbin,
               subspan_view(as_contiguous(events_.coords()[dim], event_dim_),
                            event_dim_),
-              subspan_view(as_contiguous(data, event_dim_), event_dim_),
+              subspan_view(as_contiguous(events_.data(), event_dim_),
+                           event_dim_),
               binEdges_, element::histogram, "histogram");
         },
         event_dim, binEdges);
@@ -4,6 +4,7 @@
 /// @author Simon Heybrock
 #pragma once
 
+#include "scipp/core/flags.h"
 #include "scipp/dataset/dataset.h"
 #include "scipp/variable/bins.h"
 
@@ -57,6 +58,22 @@ namespace scipp::dataset::buckets {
 SCIPP_DATASET_EXPORT void append(Variable &var0, const Variable &var1);
 SCIPP_DATASET_EXPORT void append(DataArray &a, const DataArray &b);
 
+[[nodiscard]] SCIPP_DATASET_EXPORT Variable capacity(const Variable &var);
+SCIPP_DATASET_EXPORT void reserve(Variable &var, const Variable &capacity);
+SCIPP_DATASET_EXPORT void append_events(Variable &var, const Variable &events);
+SCIPP_DATASET_EXPORT void append_events(DataArray &a, const DataArray &events);
+[[nodiscard]] SCIPP_DATASET_EXPORT Variable compact(const Variable &var);
+[[nodiscard]] SCIPP_DATASET_EXPORT DataArray compact(const DataArray &array);
+[[nodiscard]] SCIPP_DATASET_EXPORT bool is_compact(const Variable &var);
+[[nodiscard]] SCIPP_DATASET_EXPORT double fill_ratio(const Variable &var);
+
+[[nodiscard]] SCIPP_DATASET_EXPORT Variable
+sort(const Variable &var, const Dim key,
+     const SortOrder order = SortOrder::Ascending);
+[[nodiscard]] SCIPP_DATASET_EXPORT DataArray
+sort(const DataArray &array, const Dim key,
+     const SortOrder order = SortOrder::Ascending);
+
 [[nodiscard]] SCIPP_DATASET_EXPORT Variable histogram(const Variable &data,
                                                       const Variable &binEdges);
 
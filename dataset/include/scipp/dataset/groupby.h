@@ -7,29 +7,58 @@
 #include <boost/container/small_vector.hpp>
 #include <vector>
 
+#include "scipp/common/span.h"
 #include "scipp/core/flags.h"
 #include "scipp/variable/creation.h"
 #include <scipp/dataset/dataset.h>
 
 namespace scipp::dataset {
 
+/// Slices of all groups of a GroupByGrouping, stored contiguously.
+///
+/// The slices of group `i` are `slices[offsets[i]:offsets[i + 1]]`, sorted by
+/// position in the grouped dimension.
+class SCIPP_DATASET_EXPORT GroupSlices {
+public:
+  GroupSlices() = default;
+  GroupSlices(std::vector<Slice> slices, std::vector<scipp::index> offsets)
+      : m_slices(std::move(slices)), m_offsets(std::move(offsets)) {}
+
+  scipp::index size() const noexcept {
+    return m_offsets.empty() ? 0 : scipp::size(m_offsets) - 1;
+  }
+  scipp::span<const Slice> operator[](const scipp::index group) const {
+    return {m_slices.data() + m_offsets[group],
+            m_slices.data() + m_offsets[group + 1]};
+  }
+  const std::vector<Slice> &slices() const noexcept { return m_slices; }
+  const std::vector<scipp::index> &offsets() const noexcept {
+    return m_offsets;
+  }
+
+private:
+  std::vector<Slice> m_slices;
+  std::vector<scipp::index> m_offsets;
+};
+
 /// Implementation detail of GroupBy.
 ///
 /// Stores the actual grouping details, independent of the container type.
 class SCIPP_DATASET_EXPORT GroupByGrouping {
 public:
   using group = boost::container::small_vector<Slice, 4>;
-  GroupByGrouping(Variable key, std::vector<group> groups)
+  GroupByGrouping(Variable key, const std::vector<group> &groups);
+  GroupByGrouping(Variable key, GroupSlices groups)
       : m_key(std::move(key)), m_groups(std::move(groups)) {}
 
-  scipp::index size() const noexcept { return scipp::size(m_groups); }
+  scipp::index size() const noexcept { return m_groups.size(); }
   Dim dim() const noexcept { return m_key.dims().inner(); }
   const Variable &key() const noexcept { return m_key; }
-  const std::vector<group> &groups() const noexcept { return m_groups; }
+  const GroupSlices &groups() const noexcept { return m_groups; }
 
 private:
   Variable m_key;
-  std::vector<group> m_groups;
+  GroupSlices m_groups;
 };
 
 /// Helper class for implementing "split-apply-combine" functionality.
@@ -41,9 +70,7 @@ public:
   scipp::index size() const noexcept { return m_grouping.size(); }
   Dim dim() const noexcept { return m_grouping.dim(); }
   const Variable &key() const noexcept { return m_grouping.key(); }
-  const std::vector<GroupByGrouping::group> &groups() const noexcept {
-    return m_grouping.groups();
-  }
+  const GroupSlices &groups() const noexcept { return m_grouping.groups(); }
   T copy(const scipp::index group,
          const AttrPolicy attrPolicy = AttrPolicy::Keep) const;
 
@@ -58,8 +85,9 @@ public:
 
 private:
   T makeReductionOutput(const Dim reductionDim, const FillValue fill) const;
-  template <class Op>
-  T reduce(Op op, const Dim reductionDim, const FillValue fill) const;
+  template <class Op, class Kernel>
+  T reduce(Op op, Kernel kernel, const Dim reductionDim,
+           const FillValue fill) const;
 
   T m_data;
   GroupByGrouping m_grouping;
@@ -12,6 +12,7 @@
 #include "scipp/dataset/map_view_forward.h"
 #include "scipp/units/dim.h"
 #include "scipp/units/unit.h"
+#include "scipp/variable/constant.h"
 #include "scipp/variable/logical.h"
 #include "scipp/variable/variable.h"
 
@@ -185,12 +186,14 @@ protected:
 ///
 /// Irreducible means that a reduction operation must apply these masks since
 /// depend on the reduction dimension. Returns an invalid (empty) variable if
-/// there is no irreducible mask.
+/// there is no irreducible mask. Masks with a constant value of false mask
+/// nothing and are skipped.
 template <class Masks>
 [[nodiscard]] Variable irreducible_mask(const Masks &masks, const Dim dim) {
   Variable union_;
   for (const auto &mask : masks)
-    if (mask.second.dims().contains(dim))
+    if (mask.second.dims().contains(dim) &&
+        variable::constant_value<bool>(mask.second) != false)
       union_ = union_.is_valid() ? union_ | mask.second : copy(mask.second);
   return union_;
 }
@@ -0,0 +1,22 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @author Simon Heybrock
+#pragma once
+
+#include "scipp/dataset/dataset.h"
+#include "scipp/variable/take.h"
+
+namespace scipp::dataset {
+
+[[nodiscard]] SCIPP_DATASET_EXPORT DataArray
+take(const DataArray &array, const Variable &indices, const Dim dim);
+[[nodiscard]] SCIPP_DATASET_EXPORT Dataset
+take(const Dataset &dataset, const Variable &indices, const Dim dim);
+
+SCIPP_DATASET_EXPORT DataArray &put(DataArray &out, const Variable &indices,
+                                    const DataArray &array, const Dim dim);
+SCIPP_DATASET_EXPORT Dataset &put(Dataset &out, const Variable &indices,
+                                  const Dataset &dataset, const Dim dim);
+
+} // namespace scipp::dataset
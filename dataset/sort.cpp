@@ -3,45 +3,48 @@
 /// @file
 /// @author Simon Heybrock
 #include "scipp/dataset/sort.h"
-#include "scipp/dataset/groupby.h"
+#include "scipp/core/except.h"
+#include "scipp/dataset/take.h"
+#include "scipp/variable/sort.h"
 
 namespace scipp::dataset {
 
+namespace {
+template <class Dims>
+void expect_valid_key(const Dims &dims, const Variable &key) {
+  if (!dims.includes(key.dims()))
+    throw except::DimensionError("Size of sort key is incorrect.");
+}
+} // namespace
+
 /// Return a Variable sorted based on key.
 Variable sort(const Variable &var, const Variable &key, const SortOrder order) {
-  return sort(DataArray(var), key, order).data();
+  expect_valid_key(var.dims(), key);
+  return variable::take(var, variable::argsort(key, order), key.dims().inner());
 }
 
 /// Return a DataArray sorted based on key.
 DataArray sort(const DataArray &array, const Variable &key,
                const SortOrder order) {
-  auto helper = array;
-  const Dim dummy = Dim::InternalSort;
-  helper.coords().set(dummy, key);
-  helper = groupby(helper, dummy).copy(order);
-  helper.coords().erase(dummy);
-  return helper;
+  expect_valid_key(array.dims(), key);
+  return take(array, variable::argsort(key, order), key.dims().inner());
 }
 
 /// Return a DataArray sorted based on coordinate.
 DataArray sort(const DataArray &array, const Dim &key, const SortOrder order) {
-  return groupby(array, key).copy(order);
+  return sort(array, array.coords()[key], order);
 }
 
 /// Return a Dataset sorted based on key.
 Dataset sort(const Dataset &dataset, const Variable &key,
              const SortOrder order) {
-  auto helper = dataset;
-  const Dim dummy = Dim::InternalSort;
-  helper.coords().set(dummy, key);
-  helper = groupby(helper, dummy).copy(order);
-  helper.coords().erase(dummy);
-  return helper;
+  expect_valid_key(dataset.sizes(), key);
+  return take(dataset, variable::argsort(key, order), key.dims().inner());
 }
 
 /// Return a Dataset sorted based on coordinate.
 Dataset sort(const Dataset &dataset, const Dim &key, const SortOrder order) {
-  return groupby(dataset, key).copy(order);
+  return sort(dataset, dataset.coords()[key], order);
 }
 
 } // namespace scipp::dataset
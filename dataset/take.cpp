@@ -0,0 +1,182 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @author Simon Heybrock
+#include "scipp/dataset/take.h"
+#include "scipp/core/except.h"
+#include "scipp/dataset/bins.h"
+
+#include "dataset_operations_common.h"
+
+namespace scipp::dataset {
+
+namespace {
+template <class Coords>
+void expect_no_bin_edges(const Coords &coords, const Sizes &sizes,
+                         const Dim dim) {
+  if (!sizes.contains(dim))
+    return;
+  for (const auto &[key, coord] : coords)
+    if (coord.dims().contains(dim) && coord.dims()[dim] == sizes[dim] + 1)
+      throw except::BinEdgeError("Cannot take slices along " + to_string(dim) +
+                                 " of bin-edge coordinate " + to_string(key) +
+                                 ".");
+}
+
+/// Take bins by gathering the events of the buffer.
+template <class T>
+Variable take_bins(const Variable &var, const Variable &indices,
+                   const Dim dim) {
+  const auto [bin_indices, buffer_dim, buffer] = var.constituents<T>();
+  auto [out_indices, buffer_indices] =
+      variable::take_bin_indices(bin_indices, indices, dim, buffer_dim);
+  return make_bins_no_validate(std::move(out_indices), buffer_dim,
+                               take(buffer, buffer_indices, buffer_dim));
+}
+
+bool has_table_buffer(const Variable &var) {
+  return var.dtype() == dtype<bucket<DataArray>> ||
+         var.dtype() == dtype<bucket<Dataset>>;
+}
+
+/// Helper for taking all items depending on `dim` in a single pass.
+///
+/// Items are first collected with `add` and later retrieved in the same order
+/// with `get`, which returns a copy for items that do not depend on `dim`.
+/// Binned data with a DataArray or Dataset buffer is handled separately by
+/// taking its buffer.
+class BatchTake {
+public:
+  BatchTake(const Variable &indices, const Dim dim)
+      : m_indices(indices), m_dim(dim) {}
+  template <class Map> void add(const Map &map) {
+    for (const auto &[key, item] : map)
+      add(item);
+  }
+  void add(const Variable &var) {
+    if (var.dims().contains(m_dim) && !has_table_buffer(var))
+      m_in.push_back(var);
+  }
+  template <class Map> auto get(const Map &map) {
+    return transform_map(map, [this](const auto &var) { return get(var); });
+  }
+  Variable get(const Variable &var) {
+    if (!var.dims().contains(m_dim))
+      return copy(var);
+    if (var.dtype() == dtype<bucket<DataArray>>)
+      return take_bins<DataArray>(var, m_indices, m_dim);
+    if (var.dtype() == dtype<bucket<Dataset>>)
+      return take_bins<Dataset>(var, m_indices, m_dim);
+    if (m_out.empty())
+      m_out = variable::take(m_in, m_indices, m_dim);
+    return std::move(m_out[m_next++]);
+  }
+
+private:
+  const Variable &m_indices;
+  Dim m_dim;
+  std::vector<Variable> m_in;
+  std::vector<Variable> m_out;
+  size_t m_next{0};
+};
+
+template <class Map>
+void add_put_items(std::vector<Variable> &outs, std::vector<Variable> &vars,
+                   const Map &out, const Map &map, const Dim dim) {
+  for (const auto &[key, item] : out)
+    if (item.dims().contains(dim)) {
+      outs.push_back(item);
+      vars.push_back(map[key]);
+    }
+}
+
+void add_put_items(std::vector<Variable> &outs, std::vector<Variable> &vars,
+                   const DataArray &out, const DataArray &array,
+                   const Dim dim) {
+  if (out.dims().contains(dim)) {
+    outs.push_back(out.data());
+    vars.push_back(array.data());
+  }
+  add_put_items(outs, vars, out.masks(), array.masks(), dim);
+  add_put_items(outs, vars, out.attrs(), array.attrs(), dim);
+}
+} // namespace
+
+/// Return slices of `array` along `dim` given by `indices`, in order.
+///
+/// Coords, masks, and attrs depending on `dim` are taken as well, all other
+/// items are copied. All items are processed in a single pass over `indices`.
+DataArray take(const DataArray &array, const Variable &indices,
+               const Dim dim) {
+  expect_no_bin_edges(array.coords(), array.dims(), dim);
+  expect_no_bin_edges(array.attrs(), array.dims(), dim);
+  BatchTake batch(indices, dim);
+  batch.add(array.data());
+  batch.add(array.coords());
+  batch.add(array.masks());
+  batch.add(array.attrs());
+  auto data = batch.get(array.data());
+  auto coords = batch.get(array.coords());
+  auto masks = batch.get(array.masks());
+  auto attrs = batch.get(array.attrs());
+  return DataArray(std::move(data), std::move(coords), std::move(masks),
+                   std::move(attrs), array.name());
+}
+
+/// Return slices of `dataset` along `dim` given by `indices`, in order.
+///
+/// Coords, masks, and attrs depending on `dim` are taken as well, all other
+/// items are copied. All items are processed in a single pass over `indices`.
+Dataset take(const Dataset &dataset, const Variable &indices, const Dim dim) {
+  expect_no_bin_edges(dataset.coords(), dataset.sizes(), dim);
+  BatchTake batch(indices, dim);
+  batch.add(dataset.coords());
+  for (const auto &item : dataset) {
+    expect_no_bin_edges(item.attrs(), item.dims(), dim);
+    batch.add(item.data());
+    batch.add(item.masks());
+    batch.add(item.attrs());
+  }
+  Dataset out;
+  for (auto &&[key, coord] : batch.get(dataset.coords()))
+    out.setCoord(key, std::move(coord));
+  for (const auto &item : dataset) {
+    auto data = batch.get(item.data());
+    auto masks = batch.get(item.masks());
+    auto attrs = batch.get(item.attrs());
+    out.setData(item.name(), DataArray(std::move(data), {}, std::move(masks),
+                                       std::move(attrs)));
+  }
+  return out;
+}
+
+/// Set slices of `out` along `dim` given by `indices` to slices of `array`.
+///
+/// Applies to data, coords, masks, and attrs of `out` depending on `dim`, which
+/// are set from the items of `array` with the same name.
+DataArray &put(DataArray &out, const Variable &indices, const DataArray &array,
+               const Dim dim) {
+  std::vector<Variable> outs;
+  std::vector<Variable> vars;
+  add_put_items(outs, vars, out.coords(), array.coords(), dim);
+  add_put_items(outs, vars, out, array, dim);
+  variable::put(outs, indices, vars, dim);
+  return out;
+}
+
+/// Set slices of `out` along `dim` given by `indices` to slices of `dataset`.
+///
+/// Applies to all coords and items of `out` depending on `dim`, which are set
+/// from the coords and items of `dataset` with the same name.
+Dataset &put(Dataset &out, const Variable &indices, const Dataset &dataset,
+             const Dim dim) {
+  std::vector<Variable> outs;
+  std::vector<Variable> vars;
+  add_put_items(outs, vars, out.coords(), dataset.coords(), dim);
+  for (const auto &item : out)
+    add_put_items(outs, vars, item, dataset[item.name()], dim);
+  variable::put(outs, indices, vars, dim);
+  return out;
+}
+
+} // namespace scipp::dataset
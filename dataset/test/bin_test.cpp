@@ -11,6 +11,7 @@
 #include "scipp/dataset/string.h"
 #include "scipp/variable/arithmetic.h"
 #include "scipp/variable/comparison.h"
+#include "scipp/variable/linear_range.h"
 #include "scipp/variable/misc_operations.h"
 #include "scipp/variable/reduction.h"
 #include "scipp/variable/util.h"
@@ -118,6 +119,20 @@ TEST(BinGroupTest, 1d) {
             table.slice({Dim::Row, 4}));
 }
 
+TEST(BinGroupTest, linear_range) {
+  const Dimensions dims(Dim::Row, 6);
+  const auto data = makeVariable<double>(dims, Values{1, 2, 3, 4, 5, 6});
+  const auto label = makeVariable<int64_t>(dims, Values{4, 2, 3, 0, -2, 8});
+  const auto table = DataArray(data, {{Dim("label"), label}});
+  const auto groups =
+      variable::arange(Dim("label"), int64_t{0} * units::one,
+                       int64_t{6} * units::one, int64_t{2} * units::one);
+  ASSERT_TRUE(variable::has_linear_range(groups));
+  const auto expected = makeVariable<int64_t>(Dims{Dim("label")}, Shape{3},
+                                              Values{0, 2, 4});
+  EXPECT_EQ(bin(table, {}, {groups}), bin(table, {}, {expected}));
+}
+
 class BinTest : public ::testing::TestWithParam<DataArray> {
 protected:
   Variable groups = makeVariable<int64_t>(Dims{Dim("group")}, Shape{5},
@@ -2,6 +2,9 @@
 // Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cmath>
+
 #include "test_macros.h"
 
 #include "scipp/dataset/bins.h"
@@ -12,6 +15,8 @@
 #include "scipp/variable/bins.h"
 #include "scipp/variable/math.h"
 #include "scipp/variable/operations.h"
+#include "scipp/variable/shape.h"
+#include "scipp/variable/util.h"
 #include "scipp/variable/variable_factory.h"
 
 using namespace scipp;
@@ -116,6 +121,224 @@ TEST_F(DataArrayBinsTest, concatenate_with_broadcast) {
   EXPECT_THROW(buckets::append(var, var2), except::DimensionError);
 }
 
+TEST_F(DataArrayBinsTest, capacity) {
+  EXPECT_EQ(buckets::capacity(var),
+            makeVariable<scipp::index>(dims, Values{2, 2}));
+  const auto sizes = makeVariable<scipp::index>(dims, Values{3, 5});
+  auto reserved = resize(var, sizes);
+  EXPECT_EQ(buckets::capacity(reserved), sizes);
+  // No capacity information for slices
+  EXPECT_EQ(buckets::capacity(reserved.slice({Dim::Y, 1, 2})),
+            makeVariable<scipp::index>(Dims{Dim::Y}, Shape{1}, Values{0}));
+}
+
+TEST_F(DataArrayBinsTest, reserve) {
+  auto out = copy(var);
+  buckets::reserve(out, makeVariable<scipp::index>(dims, Values{3, 1}));
+  EXPECT_EQ(out, var);
+  EXPECT_EQ(buckets::capacity(out),
+            makeVariable<scipp::index>(dims, Values{3, 2}));
+}
+
+TEST_F(DataArrayBinsTest, append_events) {
+  const auto events = var * (3.0 * units::one);
+  auto out = copy(var);
+  buckets::append_events(out, events);
+  EXPECT_EQ(out, buckets::concatenate(var, events));
+  // On overflow all bins get slack of their size, but at least 8
+  EXPECT_EQ(buckets::capacity(out),
+            makeVariable<scipp::index>(dims, Values{12, 12}));
+}
+
+TEST_F(DataArrayBinsTest, append_events_to_empty_bins) {
+  const auto empty_indices = makeVariable<scipp::index_pair>(
+      dims, Values{std::pair{0, 0}, std::pair{0, 0}});
+  auto out =
+      make_bins(empty_indices, Dim::X, copy(buffer.slice({Dim::X, 0, 0})));
+  const auto expected = buckets::concatenate(out, var);
+  buckets::append_events(out, var);
+  EXPECT_EQ(out, expected);
+  EXPECT_EQ(buckets::capacity(out),
+            makeVariable<scipp::index>(dims, Values{10, 10}));
+}
+
+TEST_F(DataArrayBinsTest, append_events_does_not_write_shared_buffer) {
+  const auto table = copy(buffer);
+  const Dimensions dim1{Dim::Y, 1};
+  auto a = make_bins(
+      makeVariable<scipp::index_pair>(dim1, Values{std::pair{0, 2}}), Dim::X,
+      table);
+  const auto b = make_bins(
+      makeVariable<scipp::index_pair>(dim1, Values{std::pair{2, 4}}), Dim::X,
+      table);
+  const auto b_original = copy(b);
+  // The space after the bin of `a` is referenced by `b`
+  EXPECT_EQ(buckets::capacity(a), makeVariable<scipp::index>(dim1, Values{2}));
+  const auto expected = buckets::concatenate(a, a);
+  buckets::append_events(a, copy(a));
+  EXPECT_EQ(a, expected);
+  EXPECT_EQ(b, b_original);
+  EXPECT_EQ(table, buffer);
+}
+
+TEST_F(DataArrayBinsTest, capacity_discarded_when_indices_are_modified) {
+  auto out = copy(var);
+  buckets::reserve(out, makeVariable<scipp::index>(dims, Values{4, 4}));
+  EXPECT_EQ(buckets::capacity(out),
+            makeVariable<scipp::index>(dims, Values{4, 4}));
+  auto out_indices = out.bin_indices();
+  copy(makeVariable<scipp::index_pair>(
+           dims, Values{std::pair{0, 1}, std::pair{4, 6}}),
+       out_indices);
+  EXPECT_EQ(buckets::capacity(out),
+            makeVariable<scipp::index>(dims, Values{1, 2}));
+}
+
+TEST_F(DataArrayBinsTest, append_events_into_reserved) {
+  const auto events = var * (3.0 * units::one);
+  auto out = copy(var);
+  buckets::reserve(out, makeVariable<scipp::index>(dims, Values{4, 4}));
+  const auto buffer_handle = out.bin_buffer<DataArray>().data().data_handle();
+  buckets::append_events(out, events);
+  EXPECT_EQ(out, buckets::concatenate(var, events));
+  // Events fit into reserved capacity so the buffer is not reallocated
+  EXPECT_EQ(out.bin_buffer<DataArray>().data().data_handle(), buffer_handle);
+}
+
+TEST_F(DataArrayBinsTest, append_events_uneven) {
+  const auto uneven = makeVariable<scipp::index_pair>(
+      dims, Values{std::pair{0, 3}, std::pair{3, 3}});
+  const auto events = make_bins(uneven, Dim::X, copy(buffer));
+  auto out = copy(var);
+  for (scipp::index i = 0; i < 5; ++i) {
+    const auto expected = buckets::concatenate(out, events);
+    buckets::append_events(out, events);
+    EXPECT_EQ(out, expected);
+  }
+  EXPECT_EQ(buckets::compact(out), out);
+  EXPECT_EQ(buckets::capacity(buckets::compact(out)), bucket_sizes(out));
+}
+
+TEST_F(DataArrayBinsTest, append_events_data_array) {
+  DataArray a(copy(var), {{Dim::Y, makeVariable<double>(dims)}});
+  DataArray b(var * (2.0 * units::one), {{Dim::Y, makeVariable<double>(dims)}});
+  const auto expected = buckets::concatenate(a, b);
+  buckets::append_events(a, b);
+  EXPECT_EQ(a, expected);
+}
+
+TEST_F(DataArrayBinsTest, compact) {
+  EXPECT_TRUE(buckets::is_compact(var));
+  EXPECT_TRUE(buckets::compact(var).is_same(var));
+  auto reserved = resize(var, makeVariable<scipp::index>(dims, Values{3, 5}));
+  EXPECT_FALSE(buckets::compact(reserved).is_same(reserved));
+  EXPECT_EQ(buckets::capacity(buckets::compact(reserved)),
+            makeVariable<scipp::index>(dims, Values{0, 0}));
+}
+
+TEST_F(DataArrayBinsTest, compact_slice_does_not_copy) {
+  const auto slice = var.slice({Dim::Y, 1, 2});
+  EXPECT_FALSE(buckets::is_compact(slice));
+  EXPECT_EQ(buckets::fill_ratio(slice), 0.5);
+  const auto compacted = buckets::compact(slice);
+  EXPECT_TRUE(buckets::is_compact(compacted));
+  EXPECT_EQ(buckets::fill_ratio(compacted), 1.0);
+  EXPECT_EQ(compacted, slice);
+  EXPECT_EQ(compacted.bin_buffer<DataArray>().data().data_handle(),
+            var.bin_buffer<DataArray>().data().data_handle());
+}
+
+TEST_F(DataArrayBinsTest, compact_with_gaps) {
+  const auto gaps = makeVariable<scipp::index_pair>(
+      dims, Values{std::pair{1, 2}, std::pair{3, 4}});
+  const auto sparse = make_bins(gaps, Dim::X, copy(buffer));
+  EXPECT_FALSE(buckets::is_compact(sparse));
+  EXPECT_EQ(buckets::fill_ratio(sparse), 0.5);
+  const auto compacted = buckets::compact(sparse);
+  EXPECT_TRUE(buckets::is_compact(compacted));
+  EXPECT_EQ(compacted, sparse);
+  EXPECT_EQ(compacted.bin_buffer<DataArray>().dims()[Dim::X], 2);
+}
+
+TEST_F(DataArrayBinsTest, sort) {
+  const auto key = makeVariable<double>(Dims{Dim::X}, Shape{4},
+                                        Values{2, 1, NAN, 3});
+  const auto mask = makeVariable<bool>(Dims{Dim::X}, Shape{4},
+                                       Values{true, false, false, true});
+  const auto unsorted = make_bins(
+      indices, Dim::X, DataArray(data, {{Dim::Time, key}}, {{"mask", mask}}));
+  const auto sorted = buckets::sort(unsorted, Dim::Time);
+  EXPECT_EQ(sorted.bin_indices(), indices);
+  const auto &out = sorted.bin_buffer<DataArray>();
+  EXPECT_EQ(out.data(), makeVariable<double>(Dims{Dim::X}, Shape{4},
+                                             Values{2, 1, 4, 3}));
+  EXPECT_EQ(out.masks()["mask"],
+            makeVariable<bool>(Dims{Dim::X}, Shape{4},
+                               Values{false, true, true, false}));
+  const auto times = out.coords()[Dim::Time].values<double>();
+  EXPECT_EQ(times[0], 1);
+  EXPECT_EQ(times[1], 2);
+  EXPECT_EQ(times[2], 3);
+  EXPECT_TRUE(std::isnan(times[3]));
+  EXPECT_TRUE(buckets::sort(sorted, Dim::Time).is_same(sorted));
+  const auto descending =
+      buckets::sort(unsorted, Dim::Time, SortOrder::Descending);
+  EXPECT_EQ(descending.bin_buffer<DataArray>().data(),
+            makeVariable<double>(Dims{Dim::X}, Shape{4}, Values{1, 2, 3, 4}));
+}
+
+TEST_F(DataArrayBinsTest, sort_slice) {
+  const auto slice = var.slice({Dim::Y, 1});
+  const auto sorted = buckets::sort(slice, Dim::X, SortOrder::Descending);
+  EXPECT_TRUE(buckets::is_compact(sorted));
+  EXPECT_EQ(sorted.bin_buffer<DataArray>().data(),
+            makeVariable<double>(Dims{Dim::X}, Shape{2}, Values{4, 3}));
+}
+
+TEST_F(DataArrayBinsTest, sort_data_array) {
+  const DataArray array(var, {{Dim::Y, makeVariable<double>(dims)}});
+  const auto sorted = buckets::sort(array, Dim::X, SortOrder::Descending);
+  EXPECT_EQ(sorted.coords(), array.coords());
+  EXPECT_EQ(sorted.data(), buckets::sort(var, Dim::X, SortOrder::Descending));
+}
+
+TEST_F(DataArrayBinsTest, sort_bad_key) {
+  EXPECT_THROW_DISCARD(buckets::sort(var, Dim::Time), except::NotFoundError);
+  EXPECT_THROW_DISCARD(buckets::sort(make_bins(indices, Dim::X, copy(data)),
+                                     Dim::X),
+                       except::TypeError);
+  auto with_variances = copy(buffer);
+  with_variances.coords()[Dim::X].setVariances(data);
+  EXPECT_THROW_DISCARD(
+      buckets::sort(make_bins(indices, Dim::X, with_variances), Dim::X),
+      except::VariancesError);
+}
+
+TEST_F(DataArrayBinsTest, sort_large) {
+  const scipp::index nbin = 7;
+  const scipp::index nevent = 100000;
+  std::vector<double> values(nevent);
+  for (scipp::index i = 0; i < nevent; ++i)
+    values[i] = static_cast<double>((i * 7919) % 1009);
+  const auto key =
+      makeVariable<double>(Dims{Dim::X}, Shape{nevent}, Values(values));
+  std::vector<scipp::index_pair> ranges;
+  for (scipp::index bin = 0; bin < nbin; ++bin)
+    ranges.emplace_back(bin * bin * nevent / (nbin * nbin),
+                        (bin + 1) * (bin + 1) * nevent / (nbin * nbin));
+  const auto bin_indices = makeVariable<scipp::index_pair>(
+      Dims{Dim::Y}, Shape{nbin}, Values(ranges));
+  const auto sorted = buckets::sort(
+      make_bins(bin_indices, Dim::X, DataArray(key, {{Dim::X, key}})), Dim::X);
+  const auto out = sorted.bin_buffer<DataArray>().data().values<double>();
+  for (const auto &[begin, end] : ranges) {
+    std::vector<double> expected(values.begin() + begin, values.begin() + end);
+    std::sort(expected.begin(), expected.end());
+    EXPECT_TRUE(std::equal(expected.begin(), expected.end(),
+                           out.begin() + begin));
+  }
+}
+
 TEST_F(DataArrayBinsTest, histogram) {
   Variable weights = makeVariable<double>(
       Dims{Dim::X}, Shape{4}, Values{1, 2, 3, 4}, Variances{1, 2, 3, 4});
@@ -176,6 +399,21 @@ TEST_F(DataArrayBinsTest, sum) {
             makeVariable<double>(indices.dims(), Values{3, 7}));
 }
 
+TEST_F(DataArrayBinsTest, sum_masked_validates_modified_indices) {
+  auto masked = copy(buffer);
+  masked.masks().set("mask",
+                     makeVariable<bool>(Dims{Dim::X}, Shape{4},
+                                        Values{false, true, false, false}));
+  const auto binned = make_bins(indices, Dim::X, masked);
+  EXPECT_EQ(buckets::sum(binned),
+            makeVariable<double>(indices.dims(), Values{1, 7}));
+  // `indices` shares its data with the bin indices of `binned`.
+  copy(makeVariable<scipp::index_pair>(
+           dims, Values{std::pair{0, 3}, std::pair{2, 4}}),
+       indices);
+  EXPECT_THROW_DISCARD(buckets::sum(binned), except::SliceError);
+}
+
 TEST_F(DataArrayBinsTest, operations_on_empty) {
   const Variable empty_indices = makeVariable<scipp::index_pair>(
       Dimensions{{Dim::Y, 0}, {Dim::Z, 0}}, Values{});
@@ -46,6 +46,22 @@ TEST(DatasetOperationsTest, nansum_all_dims) {
   EXPECT_EQ(nansum(ds)["a"], nansum(da));
 }
 
+TEST(DatasetOperationsTest, sum_masked_large) {
+  // Large enough for chunked reduction of masked data to a scalar.
+  const scipp::index size = 1000000;
+  std::vector<double> values(size, 1.0);
+  std::vector<bool> mask(size);
+  for (scipp::index i = 0; i < size; ++i)
+    mask[i] = i % 4 == 0;
+  values[0] = double(NAN);
+  DataArray da{makeVariable<double>(Dims{Dim::X}, Shape{size},
+                                    Values(values.begin(), values.end()))};
+  da.masks().set("mask", makeVariable<bool>(Dims{Dim::X}, Shape{size},
+                                            Values(mask.begin(), mask.end())));
+  EXPECT_EQ(sum(da, Dim::X).data(), makeVariable<double>(Values{750000}));
+  EXPECT_EQ(mean(da, Dim::X).data(), makeVariable<double>(Values{1}));
+}
+
 template <typename T>
 class DatasetShapeChangingOpTest : public ::testing::Test {
 public:
@@ -128,6 +128,44 @@ TEST_F(GroupbyTest, copy_nan) {
             makeVariable<double>(Dims{Dim::X}, Shape{2}, Values{4, 5}));
 }
 
+TEST_F(GroupbyTest, groups) {
+  DataArray da{makeVariable<double>(Dims{Dim::X}, Shape{6})};
+  da.coords().set(Dim("labels"),
+                  makeVariable<int64_t>(Dims{Dim::X}, Shape{6},
+                                        Values{3, 1, 3, 3, 2, 1}));
+  const auto grouping = groupby(da, Dim("labels"));
+  EXPECT_EQ(grouping.key(), makeVariable<int64_t>(Dims{Dim("labels")},
+                                                  Shape{3}, Values{1, 2, 3}));
+  const auto &groups = grouping.groups();
+  ASSERT_EQ(groups.size(), 3);
+  EXPECT_EQ(std::vector(groups[0].begin(), groups[0].end()),
+            std::vector({Slice(Dim::X, 1, 2), Slice(Dim::X, 5, 6)}));
+  EXPECT_EQ(std::vector(groups[1].begin(), groups[1].end()),
+            std::vector({Slice(Dim::X, 4, 5)}));
+  EXPECT_EQ(std::vector(groups[2].begin(), groups[2].end()),
+            std::vector({Slice(Dim::X, 0, 1), Slice(Dim::X, 2, 4)}));
+}
+
+TEST_F(GroupbyTest, groups_long_key) {
+  // Long enough to be processed in multiple chunks.
+  const scipp::index size = 3 << 20;
+  std::vector<int32_t> labels(size);
+  for (scipp::index i = 0; i < size; ++i)
+    labels[i] = i / 1000;
+  DataArray da{makeVariable<float>(Dims{Dim::X}, Shape{size})};
+  da.coords().set(Dim("labels"),
+                  makeVariable<int32_t>(Dims{Dim::X}, Shape{size},
+                                        Values(std::move(labels))));
+  const auto grouping = groupby(da, Dim("labels"));
+  ASSERT_EQ(grouping.size(), (size + 999) / 1000);
+  for (scipp::index group = 0; group < grouping.size(); ++group) {
+    // Runs split by chunking are merged
+    ASSERT_EQ(grouping.groups()[group].size(), 1);
+    EXPECT_EQ(grouping.groups()[group][0],
+              Slice(Dim::X, group * 1000, std::min(size, group * 1000 + 1000)));
+  }
+}
+
 TEST_F(GroupbyTest, fail_2d_coord) {
   d.setCoord(Dim("2d"), makeVariable<float>(Dims{Dim::X, Dim::Z}, Shape{3, 2}));
   EXPECT_NO_THROW(groupby(d, Dim("labels2")));
@@ -386,6 +424,51 @@ TEST(GroupbyMaskedDataArrayTest, mean2) {
   EXPECT_TRUE(std::isnan(result.template values<double>()[3]));
 }
 
+TEST(GroupbyInterleavedTest, reduce_many_thin_slices) {
+  // Key alternates between groups at every position, i.e., every group
+  // consists of many slices of length 1 or 2.
+  const scipp::index size = 1000;
+  const scipp::index ngroup = 7;
+  std::vector<double> values(size);
+  std::vector<double> keys(size);
+  std::vector<bool> masked(size);
+  for (scipp::index i = 0; i < size; ++i) {
+    values[i] = static_cast<double>(i);
+    keys[i] = static_cast<double>((i * i) % ngroup);
+    masked[i] = i % 5 == 0;
+  }
+  DataArray arr{makeVariable<double>(Dimensions{Dim::X, size},
+                                     Values(values.begin(), values.end()),
+                                     Variances(values.begin(), values.end())),
+                {{Dim("labels"),
+                  makeVariable<double>(Dimensions{Dim::X, size},
+                                       Values(keys.begin(), keys.end()))}},
+                {{"mask", makeVariable<bool>(Dimensions{Dim::X, size},
+                                             Values(masked.begin(),
+                                                    masked.end()))}}};
+  const auto grouped = groupby(arr, Dim("labels"));
+  const auto sum = grouped.sum(Dim::X);
+  const auto max = grouped.max(Dim::X);
+  const auto mean = grouped.mean(Dim::X);
+  const auto labels = sum.coords()[Dim("labels")].values<double>();
+  for (scipp::index group = 0; group < scipp::size(labels); ++group) {
+    double expected_sum = 0.0;
+    double expected_max = std::numeric_limits<double>::lowest();
+    scipp::index count = 0;
+    for (scipp::index i = 0; i < size; ++i)
+      if (keys[i] == labels[group] && !masked[i]) {
+        expected_sum += values[i];
+        expected_max = std::max(expected_max, values[i]);
+        ++count;
+      }
+    EXPECT_EQ(sum.values<double>()[group], expected_sum);
+    EXPECT_EQ(sum.variances<double>()[group], expected_sum);
+    EXPECT_EQ(max.values<double>()[group], expected_max);
+    EXPECT_DOUBLE_EQ(mean.values<double>()[group],
+                     expected_sum / static_cast<double>(count));
+  }
+}
+
 struct GroupbyWithBinsTest : public ::testing::Test {
   GroupbyWithBinsTest() {
     d.setData("a", makeVariable<double>(Dimensions{Dim::X, 5}, units::s,
@@ -423,6 +506,57 @@ TEST_F(GroupbyWithBinsTest, bins) {
   EXPECT_EQ(groupby(d["b"], Dim("labels2"), bins).sum(Dim::X), expected["b"]);
 }
 
+TEST_F(GroupbyWithBinsTest, bin_groups) {
+  DataArray da{makeVariable<double>(Dims{Dim::X}, Shape{8})};
+  da.coords().set(
+      Dim("labels"),
+      makeVariable<double>(Dims{Dim::X}, Shape{8}, units::m,
+                           Values{0.5, 0.7, 1.0, -1.0, 2.999, NAN, 0.1, 3.0}));
+  const auto expect_groups = [](const auto &grouping) {
+    const auto &groups = grouping.groups();
+    ASSERT_EQ(groups.size(), 3);
+    EXPECT_EQ(std::vector(groups[0].begin(), groups[0].end()),
+              std::vector({Slice(Dim::X, 0, 2), Slice(Dim::X, 6, 7)}));
+    EXPECT_EQ(std::vector(groups[1].begin(), groups[1].end()),
+              std::vector({Slice(Dim::X, 2, 3)}));
+    EXPECT_EQ(std::vector(groups[2].begin(), groups[2].end()),
+              std::vector({Slice(Dim::X, 4, 5)}));
+  };
+  // Linear edges use a faster code path, results must be identical.
+  expect_groups(groupby(da, Dim("labels"),
+                        makeVariable<double>(Dims{Dim::Z}, Shape{4}, units::m,
+                                             Values{0.0, 1.0, 2.0, 3.0})));
+  expect_groups(groupby(da, Dim("labels"),
+                        makeVariable<double>(Dims{Dim::Z}, Shape{4}, units::m,
+                                             Values{0.0, 1.0, 2.5, 3.0})));
+}
+
+TEST_F(GroupbyWithBinsTest, bin_groups_long_key) {
+  // Long enough to be processed in multiple chunks.
+  const scipp::index size = 3 << 20;
+  std::vector<int64_t> labels(size);
+  for (scipp::index i = 0; i < size; ++i)
+    labels[i] = i / 1000;
+  DataArray da{makeVariable<float>(Dims{Dim::X}, Shape{size})};
+  da.coords().set(Dim("labels"),
+                  makeVariable<int64_t>(Dims{Dim::X}, Shape{size},
+                                        Values(std::move(labels))));
+  const scipp::index nbin = 100;
+  std::vector<int64_t> edges(nbin + 1);
+  for (scipp::index i = 0; i <= nbin; ++i)
+    edges[i] = 20 * i;
+  const auto bins = makeVariable<int64_t>(Dims{Dim::Z}, Shape{nbin + 1},
+                                          Values(std::move(edges)));
+  const auto grouping = groupby(da, Dim("labels"), bins);
+  ASSERT_EQ(grouping.size(), nbin);
+  for (scipp::index group = 0; group < nbin; ++group) {
+    // Runs split by chunking are merged
+    ASSERT_EQ(grouping.groups()[group].size(), 1);
+    EXPECT_EQ(grouping.groups()[group][0],
+              Slice(Dim::X, group * 20000, group * 20000 + 20000));
+  }
+}
+
 TEST_F(GroupbyWithBinsTest, bins_mean_empty) {
   auto bins = makeVariable<double>(Dims{Dim::Z}, Shape{4}, units::m,
                                    Values{0.0, 1.0, 2.0, 3.0});
@@ -3,7 +3,10 @@
 #include <gtest/gtest.h>
 
 #include "scipp/dataset/dataset.h"
+#include "scipp/variable/constant.h"
+#include "scipp/variable/creation.h"
 #include "scipp/variable/logical.h"
+#include "scipp/variable/shape.h"
 
 using namespace scipp;
 
@@ -37,3 +40,14 @@ TEST(MasksTest, irreducible_mask) {
   EXPECT_EQ(combined_y_and_xy_mask ^ irreducible_mask(a.masks(), Dim::Y), none);
   EXPECT_EQ(irreducible_mask(a.masks(), Dim::Z), Variable{});
 }
+
+TEST(MasksTest, irreducible_mask_skips_constant_false) {
+  DataArray a(makeVariable<double>(Dims{Dim::X, Dim::Y}, Shape{2, 3}));
+  const auto none = special_like(a.data(), FillValue::False);
+  ASSERT_TRUE(variable::has_constant_value(none));
+  a.masks().set("none", none);
+  EXPECT_EQ(irreducible_mask(a.masks(), Dim::X), Variable{});
+  const auto all = special_like(a.data(), FillValue::True);
+  a.masks().set("all", all);
+  EXPECT_EQ(irreducible_mask(a.masks(), Dim::X), all);
+}
@@ -0,0 +1,110 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+#include <gtest/gtest.h>
+
+#include "test_macros.h"
+
+#include "scipp/core/except.h"
+#include "scipp/dataset/bins.h"
+#include "scipp/dataset/take.h"
+
+using namespace scipp;
+using namespace scipp::dataset;
+
+class TakeTest : public ::testing::Test {
+protected:
+  Variable x = makeVariable<double>(Dims{Dim::X}, Shape{3}, Values{1, 2, 3});
+  Variable y = makeVariable<double>(Dims{Dim::Y}, Shape{2}, Values{4, 5});
+  DataArray a{makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{2, 3},
+                                   Values{1, 2, 3, 4, 5, 6}),
+              {{Dim::X, x}, {Dim::Y, y}},
+              {{"mask", makeVariable<bool>(Dims{Dim::X}, Shape{3},
+                                           Values{true, false, false})}},
+              {{Dim("attr"), x + x}}};
+  Variable indices =
+      makeVariable<scipp::index>(Dims{Dim::X}, Shape{2}, Values{2, 0});
+};
+
+TEST_F(TakeTest, data_array) {
+  const auto taken_x =
+      makeVariable<double>(Dims{Dim::X}, Shape{2}, Values{3, 1});
+  const DataArray expected{
+      makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{2, 2},
+                           Values{3, 1, 6, 4}),
+      {{Dim::X, taken_x}, {Dim::Y, y}},
+      {{"mask",
+        makeVariable<bool>(Dims{Dim::X}, Shape{2}, Values{false, true})}},
+      {{Dim("attr"), taken_x + taken_x}}};
+  EXPECT_EQ(take(a, indices, Dim::X), expected);
+}
+
+TEST_F(TakeTest, data_array_copies_items_independent_of_dim) {
+  const auto taken = take(a, indices, Dim::X);
+  EXPECT_FALSE(taken.coords()[Dim::Y].is_same(a.coords()[Dim::Y]));
+}
+
+TEST_F(TakeTest, data_array_bin_edges) {
+  a.coords().set(Dim::X, makeVariable<double>(Dims{Dim::X}, Shape{4}));
+  EXPECT_THROW_DISCARD(take(a, indices, Dim::X), except::BinEdgeError);
+  const auto rows =
+      makeVariable<scipp::index>(Dims{Dim::Y}, Shape{2}, Values{1, 0});
+  EXPECT_NO_THROW_DISCARD(take(a, rows, Dim::Y));
+}
+
+TEST_F(TakeTest, dataset) {
+  Dataset d;
+  d.setCoord(Dim::X, x);
+  d.setData("a", a.data());
+  d.setData("scalar", makeVariable<double>(Values{1.2}));
+  Dataset expected;
+  expected.setCoord(Dim::X,
+                    makeVariable<double>(Dims{Dim::X}, Shape{2}, Values{3, 1}));
+  expected.setData("a", makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{2, 2},
+                                             Values{3, 1, 6, 4}));
+  expected.setData("scalar", makeVariable<double>(Values{1.2}));
+  EXPECT_EQ(take(d, indices, Dim::X), expected);
+}
+
+TEST_F(TakeTest, binned_data_array) {
+  const auto buffer =
+      DataArray(makeVariable<double>(Dims{Dim::Event}, Shape{4},
+                                     Values{1, 2, 3, 4}),
+                {{Dim::X, makeVariable<double>(Dims{Dim::Event}, Shape{4},
+                                               Values{5, 6, 7, 8})}});
+  const auto bin_indices = makeVariable<scipp::index_pair>(
+      Dims{Dim::Y}, Shape{2}, Values{std::pair{0, 1}, std::pair{1, 4}});
+  const DataArray binned(make_bins(bin_indices, Dim::Event, buffer));
+  const auto rows =
+      makeVariable<scipp::index>(Dims{Dim::Y}, Shape{3}, Values{1, 0, 1});
+  const auto expected_buffer = DataArray(
+      makeVariable<double>(Dims{Dim::Event}, Shape{7},
+                           Values{2, 3, 4, 1, 2, 3, 4}),
+      {{Dim::X, makeVariable<double>(Dims{Dim::Event}, Shape{7},
+                                     Values{6, 7, 8, 5, 6, 7, 8})}});
+  const auto expected_indices = makeVariable<scipp::index_pair>(
+      Dims{Dim::Y}, Shape{3},
+      Values{std::pair{0, 3}, std::pair{3, 4}, std::pair{4, 7}});
+  const DataArray expected(
+      make_bins(expected_indices, Dim::Event, expected_buffer));
+  EXPECT_EQ(take(binned, rows, Dim::Y), expected);
+}
+
+TEST_F(TakeTest, put_data_array) {
+  auto out = copy(a);
+  const auto permutation =
+      makeVariable<scipp::index>(Dims{Dim::X}, Shape{3}, Values{1, 2, 0});
+  put(out, permutation, take(a, permutation, Dim::X), Dim::X);
+  EXPECT_EQ(out, a);
+}
+
+TEST_F(TakeTest, put_data_array_partial) {
+  auto out = copy(a);
+  put(out, makeVariable<scipp::index>(Dims{Dim::X}, Shape{1}, Values{1}),
+      a.slice({Dim::X, 2, 3}), Dim::X);
+  EXPECT_EQ(out.slice({Dim::X, 1, 2}).data(), a.slice({Dim::X, 2, 3}).data());
+  EXPECT_EQ(out.slice({Dim::X, 1, 2}).coords()[Dim::X],
+            a.slice({Dim::X, 2, 3}).coords()[Dim::X]);
+  EXPECT_EQ(out.slice({Dim::X, 1, 2}).masks()["mask"],
+            a.slice({Dim::X, 2, 3}).masks()["mask"]);
+  EXPECT_EQ(out.slice({Dim::X, 0, 1}), a.slice({Dim::X, 0, 1}));
+}
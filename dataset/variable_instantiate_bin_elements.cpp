@@ -10,6 +10,8 @@
 #include "scipp/variable/bins.h"
 #include "scipp/variable/string.h"
 
+#include "../variable/operations_common.h"
+
 namespace scipp::variable {
 
 INSTANTIATE_BIN_ARRAY_VARIABLE(DatasetView, Dataset)
@@ -36,8 +38,7 @@ private:
     auto buffer = DataArray(
         variable::variableFactory().create(type, dims, unit, variances),
         copy(source.coords()), copy(source.masks()), copy(source.attrs()));
-    // TODO is the copy needed?
-    return make_bins(copy(indices), dim, std::move(buffer));
+    return variable::make_bins_contiguous(indices, dim, std::move(buffer));
   }
   const Variable &data(const Variable &var) const override {
     return buffer(var).data();
@@ -6,6 +6,7 @@
 
 #include "../variable/operations_common.h"
 #include "scipp/variable/arithmetic.h"
+#include "scipp/variable/math.h" // needed by operations_common.h
 #include "scipp/variable/reduction.h"
 #include "scipp/variable/special_values.h"
 #include "scipp/variable/transform.h"
@@ -15,14 +16,10 @@
 
 namespace scipp::dataset {
 
-namespace {
-Variable zero_like(const Variable &var) { return {var, Dimensions{}}; }
-} // namespace
-
 Variable sum(const Variable &var, const Dim dim, const Masks &masks) {
   if (const auto mask_union = irreducible_mask(masks, dim);
       mask_union.is_valid()) {
-    return sum(where(mask_union, zero_like(var), var), dim);
+    return masked_sum(var, dim, mask_union);
   }
   return sum(var, dim);
 }
@@ -31,7 +28,7 @@ Variable &sum(const Variable &var, const Dim dim, const Masks &masks,
               Variable &out) {
   if (const auto mask_union = irreducible_mask(masks, dim);
       mask_union.is_valid()) {
-    return sum(where(mask_union, zero_like(var), var), dim, out);
+    return masked_sum(var, dim, mask_union, out);
   }
   return sum(var, dim, out);
 }
@@ -39,7 +36,7 @@ Variable &sum(const Variable &var, const Dim dim, const Masks &masks,
 Variable nansum(const Variable &var, const Dim dim, const Masks &masks) {
   if (const auto mask_union = irreducible_mask(masks, dim);
       mask_union.is_valid()) {
-    return nansum(where(mask_union, zero_like(var), var), dim);
+    return masked_nansum(var, dim, mask_union);
   }
   return nansum(var, dim);
 }
@@ -48,7 +45,7 @@ Variable &nansum(const Variable &var, const Dim dim, const Masks &masks,
                  Variable &out) {
   if (const auto mask_union = irreducible_mask(masks, dim);
       mask_union.is_valid()) {
-    return nansum(where(mask_union, zero_like(var), var), dim, out);
+    return masked_nansum(var, dim, mask_union, out);
   }
   return nansum(var, dim, out);
 }
@@ -56,8 +53,8 @@ Variable &nansum(const Variable &var, const Dim dim, const Masks &masks,
 Variable mean(const Variable &var, const Dim dim, const Masks &masks) {
   if (const auto mask_union = irreducible_mask(masks, dim);
       mask_union.is_valid()) {
-    return mean_impl(where(mask_union, zero_like(var), var), dim,
-                     sum(~mask_union, dim));
+    return normalize_impl(masked_sum(var, dim, mask_union),
+                          sum(~mask_union, dim));
   }
   return mean(var, dim);
 }
@@ -66,9 +63,8 @@ Variable nanmean(const Variable &var, const Dim dim, const Masks &masks) {
   using variable::isfinite;
   if (const auto mask_union = irreducible_mask(masks, dim);
       mask_union.is_valid()) {
-    const auto count = sum(
-        where(mask_union, makeVariable<bool>(Values{false}), ~isnan(var)), dim);
-    return nanmean_impl(where(mask_union, zero_like(var), var), dim, count);
+    const auto count = masked_sum(~isnan(var), dim, mask_union);
+    return normalize_impl(masked_nansum(var, dim, mask_union), count);
   }
   return nanmean(var, dim);
 }
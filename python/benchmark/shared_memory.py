@@ -0,0 +1,56 @@
+# SPDX-License-Identifier: BSD-3-Clause
+# Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+# @file
+from concurrent.futures import ProcessPoolExecutor
+import time
+import scipp as sc
+import numpy as np
+
+
+def make_events(size):
+    events = sc.DataArray(data=sc.ones(dims=['event'], shape=[size]),
+                          coords={
+                              'x':
+                              sc.array(dims=['event'],
+                                       values=np.random.rand(size))
+                          })
+    return sc.bin(events, edges=[sc.linspace('x', 0.0, 1.0, num=1001)])
+
+
+def total_from_object(da):
+    return float(da.bins.size().sum().value)
+
+
+def total_from_shared_memory(name):
+    return total_from_object(sc.io.open_shared_memory(name))
+
+
+def send_to_worker(size, n_iterations=5):
+    da = make_events(size)
+    size_bytes = da.bins.constituents['data'].values.nbytes * 2
+    with ProcessPoolExecutor(max_workers=1) as executor:
+        # Start the worker before timing.
+        executor.submit(total_from_object, da['x', 0:1]).result()
+
+        start_time = time.perf_counter()
+        for _ in range(n_iterations):
+            executor.submit(total_from_object, da).result()
+        pickle_time = (time.perf_counter() - start_time) / n_iterations
+
+        start_time = time.perf_counter()
+        for _ in range(n_iterations):
+            with sc.io.to_shared_memory(da) as block:
+                executor.submit(total_from_shared_memory, block.name).result()
+        shared_memory_time = (time.perf_counter() - start_time) / n_iterations
+
+    return {
+        'n_events': size,
+        'mbytes': size_bytes / 1e6,
+        'pickle_ms': pickle_time * 1e3,
+        'shared_memory_ms': shared_memory_time * 1e3,
+    }
+
+
+if __name__ == '__main__':
+    for size in [1e5, 1e6, 1e7, 1e8]:
+        print('send_to_worker', send_to_worker(int(size)))
@@ -92,6 +92,9 @@ class DataAccessHelper {
           ~py::detail::npy_api::NPY_ARRAY_WRITEABLE_;
       return std::move(array); // no automatic move because of type mismatch
     } else {
+      // Writes through the array cannot be tracked, so cached properties of
+      // the data would become stale.
+      var.data_handle()->disable_cache();
       return py::array{get_dtype(), dims.shape(),
                        numpy_strides<T>(var.strides()),
                        Getter::template get<T>(view).data(),
@@ -265,12 +268,14 @@ public:
       auto elems = structure_elements(view);
       set_values(elems, obj);
     } else {
+      const auto write = scoped_write(view);
       set(view.dims(), view.unit(), get<get_values>(view), obj);
     }
   }
 
   template <class Var>
   static void set_variances(Var &view, const py::object &obj) {
+    const auto write = scoped_write(view);
     if (obj.is_none())
       return remove_variances(view);
     if (!view.hasVariances())
@@ -279,6 +284,14 @@ public:
   }
 
 private:
+  // Setters do not retain the mutable views they write to, so they do not
+  // disable caching of properties of the data.
+  template <class Var>
+  static scipp::variable::ScopedWrite scoped_write(Var &view) {
+    auto &&var = get_data_variable(view);
+    return scipp::variable::ScopedWrite(var.data());
+  }
+
   template <class Scalar, class View>
   static auto make_scalar(Scalar &&scalar, py::object parent,
                           const View &view) {
@@ -372,6 +385,7 @@ public:
   // variable is 0-dimensional and thus has only a single item.
   template <class Var> static void set_value(Var &view, const py::object &obj) {
     expect_scalar(view.dims(), "value");
+    const auto write = scoped_write(view);
     std::visit(SetScalarVisitor<decltype(view)>{obj, view},
                get<get_values>(view));
   }
@@ -380,6 +394,7 @@ public:
   template <class Var>
   static void set_variance(Var &view, const py::object &obj) {
     expect_scalar(view.dims(), "variance");
+    const auto write = scoped_write(view);
     if (obj.is_none())
       return remove_variances(view);
     if (!view.hasVariances())
@@ -137,28 +137,34 @@ template <class T> struct slicer {
                                                             slice, obj);
   }
 
+  template <class Other>
+  static void set_slice(T &self, const Slice slice, const Other &data) {
+    py::gil_scoped_release release; // release only *after* using py::slice
+    self.setSlice(slice, data);
+  }
+
   template <class Other>
   static void set_from_view(T &self, const std::tuple<Dim, scipp::index> &index,
                             const Other &data) {
-    self.setSlice(get_slice(self, index), data);
+    set_slice(self, get_slice(self, index), data);
   }
 
   template <class Other>
   static void set_from_view(T &self,
                             const std::tuple<Dim, const py::slice> &index,
                             const Other &data) {
-    self.setSlice(get_slice_range(self, index), data);
+    set_slice(self, get_slice_range(self, index), data);
   }
 
   template <class Other>
   static void set_from_view(T &self, const py::ellipsis &, const Other &data) {
-    self.setSlice(Slice{}, data);
+    set_slice(self, Slice{}, data);
   }
 
   template <class Other>
   static void set_by_value(T &self, const std::tuple<Dim, Variable> &value,
                            const Other &data) {
-    self.setSlice(slicer<T>::get_slice_by_value(self, value), data);
+    set_slice(self, slicer<T>::get_slice_by_value(self, value), data);
   }
 
   // Manually dispatch based on the object we are assigning from in order to
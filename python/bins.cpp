@@ -3,6 +3,9 @@
 /// @file
 /// @author Simon Hezbrock
 #include "scipp/dataset/bins.h"
+
+#include <algorithm>
+
 #include "scipp/core/except.h"
 #include "scipp/dataset/bin.h"
 #include "scipp/dataset/bins_view.h"
@@ -13,10 +16,12 @@
 #include "scipp/variable/shape.h"
 #include "scipp/variable/util.h"
 #include "scipp/variable/variable.h"
+#include "scipp/variable/variable_concept.h"
 #include "scipp/variable/variable_factory.h"
 
 #include "bind_data_array.h"
 #include "pybind11.h"
+#include "sort_order.h"
 
 using namespace scipp;
 
@@ -25,18 +30,20 @@ namespace py = pybind11;
 namespace {
 
 template <class T>
-auto call_make_bins(const py::object &begin_obj, const py::object &end_obj,
-                    const Dim dim, T &&data) {
+auto call_make_bins(const std::optional<Variable> &begin,
+                    const std::optional<Variable> &end, const Dim dim,
+                    T &&data) {
   Variable indices;
   Dimensions dims;
-  if (!begin_obj.is_none()) {
-    const auto &begin = begin_obj.cast<Variable>();
-    dims = begin.dims();
-    if (!end_obj.is_none()) {
-      const auto &end = end_obj.cast<Variable>();
-      indices = zip(begin, end);
+  if (begin) {
+    dims = begin->dims();
+    if (end) {
+      indices = zip(*begin, *end);
     } else {
-      indices = zip(begin, begin);
+      indices = zip(*begin, *begin);
+      // The view is not retained, so the indices can still be validated and
+      // the result recorded by make_bins.
+      const variable::ScopedWrite write(indices.data());
       const auto indices_ = indices.values<scipp::index_pair>();
       const auto nindex = scipp::size(indices_);
       for (scipp::index i = 0; i < nindex; ++i) {
@@ -46,27 +53,49 @@ auto call_make_bins(const py::object &begin_obj, const py::object &end_obj,
           indices_[i].second = data.dims()[dim];
       }
     }
-  } else if (end_obj.is_none()) {
+  } else if (!end) {
     const auto one = scipp::index{1} * units::one;
     const auto ones = broadcast(one, {dim, data.dims()[dim]});
-    const auto begin = cumsum(ones, dim, CumSumMode::Exclusive);
-    indices = zip(begin, begin + one);
+    const auto begin_ = cumsum(ones, dim, CumSumMode::Exclusive);
+    indices = zip(begin_, begin_ + one);
   } else {
     throw std::runtime_error("`end` given but not `begin`");
   }
   return make_bins(std::move(indices), dim, std::forward<T>(data));
 }
 
+bool has_readonly(const Variable &var) { return var.is_readonly(); }
+
+template <class Mapping> bool has_readonly_item(const Mapping &map) {
+  return std::any_of(map.begin(), map.end(), [](const auto &item) {
+    return item.second.is_readonly();
+  });
+}
+
+bool has_readonly(const DataArray &da) {
+  return da.data().is_readonly() || has_readonly_item(da.coords()) ||
+         has_readonly_item(da.masks()) || has_readonly_item(da.attrs());
+}
+
+bool has_readonly(const Dataset &ds) {
+  return std::any_of(ds.begin(), ds.end(),
+                     [](const auto &item) { return has_readonly(item); });
+}
+
 template <class T> void bind_bins(pybind11::module &m) {
   m.def(
       "bins",
-      [](const py::object &begin_obj, const py::object &end_obj, const Dim dim,
-         const T &data) {
-        return call_make_bins(begin_obj, end_obj, dim, T(data));
+      [](const std::optional<Variable> &begin,
+         const std::optional<Variable> &end, const Dim dim, const T &data) {
+        // Buffers shared with read-only memory, e.g., from Arrow or shared
+        // memory, must not be writable via the bins.
+        const bool readonly = has_readonly(data);
+        auto out = call_make_bins(begin, end, dim, T(data));
+        return readonly ? out.as_const() : out;
       },
-      py::arg("begin") = py::none(), py::arg("end") = py::none(),
-      py::arg("dim"), py::arg("data")); // do not release GIL since using
-                                        // implicit conversions in functor
+      py::arg("begin") = std::optional<Variable>{},
+      py::arg("end") = std::optional<Variable>{}, py::arg("dim"),
+      py::arg("data"), py::call_guard<py::gil_scoped_release>());
 }
 
 template <class T> void bind_bin_size(pybind11::module &m) {
@@ -196,6 +225,54 @@ void init_buckets(py::module &m) {
         return dataset::buckets::append(a, b);
       },
       py::call_guard<py::gil_scoped_release>());
+  buckets.def(
+      "capacity",
+      [](const Variable &var) { return dataset::buckets::capacity(var); },
+      py::call_guard<py::gil_scoped_release>());
+  buckets.def(
+      "reserve",
+      [](Variable &var, const Variable &capacity) {
+        return dataset::buckets::reserve(var, capacity);
+      },
+      py::call_guard<py::gil_scoped_release>());
+  buckets.def(
+      "append_events",
+      [](Variable &a, const Variable &b) {
+        return dataset::buckets::append_events(a, b);
+      },
+      py::call_guard<py::gil_scoped_release>());
+  buckets.def(
+      "append_events",
+      [](DataArray &a, const DataArray &b) {
+        return dataset::buckets::append_events(a, b);
+      },
+      py::call_guard<py::gil_scoped_release>());
+  buckets.def(
+      "compact",
+      [](const Variable &var) { return dataset::buckets::compact(var); },
+      py::call_guard<py::gil_scoped_release>());
+  buckets.def(
+      "compact",
+      [](const DataArray &array) { return dataset::buckets::compact(array); },
+      py::call_guard<py::gil_scoped_release>());
+  buckets.def("is_compact", dataset::buckets::is_compact,
+              py::call_guard<py::gil_scoped_release>());
+  buckets.def("fill_ratio", dataset::buckets::fill_ratio,
+              py::call_guard<py::gil_scoped_release>());
+  buckets.def(
+      "sort",
+      [](const Variable &var, const Dim key, const std::string &order) {
+        return dataset::buckets::sort(var, key, get_sort_order(order));
+      },
+      py::arg("x"), py::arg("key"), py::arg("order") = "ascending",
+      py::call_guard<py::gil_scoped_release>());
+  buckets.def(
+      "sort",
+      [](const DataArray &array, const Dim key, const std::string &order) {
+        return dataset::buckets::sort(array, key, get_sort_order(order));
+      },
+      py::arg("x"), py::arg("key"), py::arg("order") = "ascending",
+      py::call_guard<py::gil_scoped_release>());
   buckets.def("map", dataset::buckets::map,
               py::call_guard<py::gil_scoped_release>());
   buckets.def("scale", dataset::buckets::scale,
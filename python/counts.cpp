@@ -15,26 +15,26 @@ void init_counts(py::module &m) {
   m.def(
       "counts_to_density",
       [](const Dataset &d, const Dim dim) { return counts::toDensity(d, dim); },
-      py::arg("x"), py::arg("dim"));
+      py::arg("x"), py::arg("dim"), py::call_guard<py::gil_scoped_release>());
 
   m.def(
       "counts_to_density",
       [](const DataArray &d, const Dim dim) {
         return counts::toDensity(d, dim);
       },
-      py::arg("x"), py::arg("dim"));
+      py::arg("x"), py::arg("dim"), py::call_guard<py::gil_scoped_release>());
 
   m.def(
       "density_to_counts",
       [](const Dataset &d, const Dim dim) {
         return counts::fromDensity(d, dim);
       },
-      py::arg("x"), py::arg("dim"));
+      py::arg("x"), py::arg("dim"), py::call_guard<py::gil_scoped_release>());
 
   m.def(
       "density_to_counts",
       [](const DataArray &d, const Dim dim) {
         return counts::fromDensity(d, dim);
       },
-      py::arg("x"), py::arg("dim"));
+      py::arg("x"), py::arg("dim"), py::call_guard<py::gil_scoped_release>());
 }
@@ -153,6 +153,7 @@ void init_dataset(py::module &m) {
           py::arg("masks") = std::unordered_map<std::string, Variable>{},
           py::arg("attrs") = std::unordered_map<Dim, Variable>{},
           py::arg("name") = std::string{},
+          py::call_guard<py::gil_scoped_release>(),
           R"(__init__(self, data: Variable, coords: Dict[str, Variable] = {}, masks: Dict[str, Variable] = {}, attrs: Dict[str, Variable] = {}, name: str = '') -> None
 
           DataArray initializer.
@@ -168,13 +169,18 @@ void init_dataset(py::module &m) {
           :type attrs: Dict[str, Variable]
           :type name: str
           )")
-      .def("__sizeof__",
-           [](const DataArray &array) {
-             return size_of(array, SizeofTag::ViewOnly, true);
-           })
-      .def("underlying_size", [](const DataArray &self) {
-        return size_of(self, SizeofTag::Underlying);
-      });
+      .def(
+          "__sizeof__",
+          [](const DataArray &array) {
+            return size_of(array, SizeofTag::ViewOnly, true);
+          },
+          py::call_guard<py::gil_scoped_release>())
+      .def(
+          "underlying_size",
+          [](const DataArray &self) {
+            return size_of(self, SizeofTag::Underlying);
+          },
+          py::call_guard<py::gil_scoped_release>());
   options.enable_function_signatures();
 
   bind_data_array(dataArray);
@@ -201,6 +207,7 @@ void init_dataset(py::module &m) {
       py::arg("data") =
           std::map<std::string, std::variant<Variable, DataArray>>{},
       py::arg("coords") = std::map<Dim, Variable>{},
+      py::call_guard<py::gil_scoped_release>(),
       R"(__init__(self, data: Dict[str, Union[Variable, DataArray]] = {}, coords: Dict[str, Variable] = {}) -> None
 
               Dataset initializer.
@@ -213,25 +220,34 @@ void init_dataset(py::module &m) {
   options.enable_function_signatures();
 
   dataset
-      .def("__setitem__",
-           [](Dataset &self, const std::string &name, const Variable &data) {
-             self.setData(name, data);
-           })
-      .def("__setitem__",
-           [](Dataset &self, const std::string &name, const DataArray &data) {
-             self.setData(name, data);
-           })
+      .def(
+          "__setitem__",
+          [](Dataset &self, const std::string &name, const Variable &data) {
+            self.setData(name, data);
+          },
+          py::call_guard<py::gil_scoped_release>())
+      .def(
+          "__setitem__",
+          [](Dataset &self, const std::string &name, const DataArray &data) {
+            self.setData(name, data);
+          },
+          py::call_guard<py::gil_scoped_release>())
       .def("__delitem__", &Dataset::erase,
            py::call_guard<py::gil_scoped_release>())
-      .def("clear", &Dataset::clear,
+      .def("clear", &Dataset::clear, py::call_guard<py::gil_scoped_release>(),
            R"(Removes all data, preserving coordinates.)")
-      .def("__sizeof__",
-           [](const Dataset &self) {
-             return size_of(self, SizeofTag::ViewOnly);
-           })
-      .def("underlying_size", [](const Dataset &self) {
-        return size_of(self, SizeofTag::Underlying);
-      });
+      .def(
+          "__sizeof__",
+          [](const Dataset &self) {
+            return size_of(self, SizeofTag::ViewOnly);
+          },
+          py::call_guard<py::gil_scoped_release>())
+      .def(
+          "underlying_size",
+          [](const Dataset &self) {
+            return size_of(self, SizeofTag::Underlying);
+          },
+          py::call_guard<py::gil_scoped_release>());
 
   bind_dataset_view_methods(dataset);
 
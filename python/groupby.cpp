@@ -79,7 +79,7 @@ template <class T> void bind_groupby(py::module &m, const std::string &name) {
       [](const GroupBy<T> &self, const scipp::index &group) {
         return self.copy(group);
       },
-      py::arg("group"),
+      py::arg("group"), py::call_guard<py::gil_scoped_release>(),
       Docstring()
           .description("Extract group as new data array or dataset.")
           .rtype<T>()
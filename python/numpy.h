@@ -4,11 +4,14 @@
 /// @author Simon Heybrock
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <vector>
 
 #include "scipp/common/index_composition.h"
-#include "scipp/core/parallel.h"
+#include "scipp/core/strided_copy.h"
 #include "scipp/variable/variable.h"
 
 #include "py_object.h"
@@ -85,54 +88,35 @@ auto cast_to_array_like(const py::object &obj, const units::Unit unit) {
   }
 }
 
-template <bool convert, class T, class View>
-void copy_flattened_0d(const py::array_t<T> &data, View &&view) {
-  auto r = data.unchecked();
-  auto it = view.begin();
-  copy_element<convert>(r(), *it);
+/// Return the strides of `array` in units of elements.
+template <class T>
+std::vector<scipp::index> element_strides(const py::array_t<T> &array) {
+  std::vector<scipp::index> strides(array.ndim());
+  for (ssize_t d = 0; d < array.ndim(); ++d)
+    strides[d] = array.strides(d) / static_cast<ssize_t>(sizeof(T));
+  return strides;
 }
 
-template <bool convert, class T, class View>
-void copy_flattened_1d(const py::array_t<T> &data, View &&view) {
-  auto r = data.unchecked();
-  auto it = view.begin();
-  for (ssize_t i = 0; i < r.shape(0); ++i, ++it) {
-    copy_element<convert>(r(i), *it);
+/// Return a pointer to the first element of `dst` and its strides in units of
+/// elements. `dst` is assumed to be contiguous with given shape.
+template <class T>
+auto destination_layout(element_array<T> &dst,
+                        const std::vector<scipp::index> &shape) {
+  std::vector<scipp::index> strides(shape.size());
+  scipp::index stride = 1;
+  for (auto d = scipp::size(shape) - 1; d >= 0; --d) {
+    strides[d] = stride;
+    stride *= shape[d];
   }
+  return std::pair{dst.data(), std::move(strides)};
 }
 
-template <bool convert, class T, class View>
-void copy_flattened_2d(const py::array_t<T> &data, View &&view) {
-  auto r = data.unchecked();
-  const auto begin = view.begin();
-  core::parallel::parallel_for(
-      core::parallel::blocked_range(0, r.shape(0)), [&](const auto &range) {
-        auto it = begin + range.begin() * r.shape(1);
-        for (ssize_t i = range.begin(); i < range.end(); ++i)
-          for (ssize_t j = 0; j < r.shape(1); ++j, ++it)
-            copy_element<convert>(r(i, j), *it);
-      });
-}
-
-template <bool convert, class T, class View>
-void copy_flattened_3d(const py::array_t<T> &data, View &&view) {
-  auto r = data.unchecked();
-  auto it = view.begin();
-  for (ssize_t i = 0; i < r.shape(0); ++i)
-    for (ssize_t j = 0; j < r.shape(1); ++j)
-      for (ssize_t k = 0; k < r.shape(2); ++k, ++it)
-        copy_element<convert>(r(i, j, k), *it);
-}
-
-template <bool convert, class T, class View>
-void copy_flattened_4d(const py::array_t<T> &data, View &&view) {
-  auto r = data.unchecked();
-  auto it = view.begin();
-  for (ssize_t i = 0; i < r.shape(0); ++i)
-    for (ssize_t j = 0; j < r.shape(1); ++j)
-      for (ssize_t k = 0; k < r.shape(2); ++k)
-        for (ssize_t l = 0; l < r.shape(3); ++l, ++it)
-          copy_element<convert>(r(i, j, k, l), *it);
+template <class T>
+auto destination_layout(const ElementArrayView<T> &dst,
+                        const std::vector<scipp::index> &shape) {
+  return std::pair{dst.buffer() + dst.offset(),
+                   std::vector<scipp::index>(
+                       dst.strides().begin(), dst.strides().end(shape.size()))};
 }
 
 template <class T> auto memory_begin_end(const py::buffer_info &info) {
@@ -167,25 +151,34 @@ void copy_flattened(const py::array_t<T> &src, View &&dst) {
     throw std::runtime_error(
         "Numpy data size does not match size of target object.");
 
-  const auto dispatch = [](const py::array_t<T> &src_, View &&dst_) {
-    switch (src_.ndim()) {
-    case 0:
-      return copy_flattened_0d<convert>(src_, std::forward<View>(dst_));
-    case 1:
-      return copy_flattened_1d<convert>(src_, std::forward<View>(dst_));
-    case 2:
-      return copy_flattened_2d<convert>(src_, std::forward<View>(dst_));
-    case 3:
-      return copy_flattened_3d<convert>(src_, std::forward<View>(dst_));
-    case 4:
-      return copy_flattened_4d<convert>(src_, std::forward<View>(dst_));
-    default:
-      throw std::runtime_error("Numpy array has more dimensions than supported "
-                               "in the current implementation.");
-    }
-  };
-  dispatch(memory_overlaps(src, dst) ? py::array_t<T>(src.request()) : src,
-           std::forward<View>(dst));
+  // Byte strides that are not a multiple of the element size, e.g., from
+  // structured arrays, cannot be expressed in units of elements.
+  const bool misaligned =
+      reinterpret_cast<std::uintptr_t>(src.data()) % alignof(T) != 0 ||
+      std::any_of(src.strides(), src.strides() + src.ndim(),
+                  [](const ssize_t stride) {
+                    return stride % static_cast<ssize_t>(sizeof(T)) != 0;
+                  });
+  py::array_t<T> source = src;
+  if (misaligned)
+    source = py::array_t<T>(py::array_t<T, py::array::c_style>::ensure(src));
+  else if (memory_overlaps(src, dst))
+    source = py::array_t<T>(src.request());
+  const std::vector<scipp::index> shape(source.shape(),
+                                        source.shape() + source.ndim());
+  const auto src_strides = element_strides(source);
+  const auto *src_data = source.data();
+  auto [dst_data, dst_strides] = destination_layout(dst, shape);
+  // Only arrays of POD types reach this point, elements are copied without
+  // calling into Python.
+  py::gil_scoped_release release;
+  if constexpr (convert)
+    core::strided_copy(shape, src_data, src_strides, dst_data, dst_strides,
+                       [](auto &dst_element, const auto &src_element) {
+                         copy_element<convert>(src_element, dst_element);
+                       });
+  else // The default assignment allows for using memcpy.
+    core::strided_copy(shape, src_data, src_strides, dst_data, dst_strides);
 }
 
 template <class SourceDType, class Destination>
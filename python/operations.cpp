@@ -4,9 +4,11 @@
 /// @author Simon Heybrock
 #include "docstring.h"
 #include "pybind11.h"
+#include "sort_order.h"
 
 #include "scipp/dataset/dataset.h"
 #include "scipp/dataset/sort.h"
+#include "scipp/dataset/take.h"
 #include "scipp/variable/operations.h"
 #include "scipp/variable/slice.h"
 #include "scipp/variable/sort.h"
@@ -18,15 +20,6 @@ using namespace scipp::dataset;
 
 namespace py = pybind11;
 
-auto get_sort_order(const std::string &order) {
-  if (order == "ascending")
-    return SortOrder::Ascending;
-  else if (order == "descending")
-    return SortOrder::Descending;
-  else
-    throw std::runtime_error("Sort order must be 'ascending' or 'descending'");
-}
-
 template <typename T> void bind_dot(py::module &m) {
   m.def(
       "dot", [](const T &x, const T &y) { return dot(x, y); }, py::arg("x"),
@@ -53,6 +46,37 @@ template <typename T> void bind_sort_dim(py::module &m) {
       py::call_guard<py::gil_scoped_release>());
 }
 
+template <typename T> void bind_take(py::module &m) {
+  m.def(
+      "take",
+      [](const T &x, const Variable &indices, const Dim dim) {
+        return take(x, indices, dim);
+      },
+      py::arg("x"), py::arg("indices"), py::arg("dim"),
+      py::call_guard<py::gil_scoped_release>());
+}
+
+template <typename T> void bind_put(py::module &m) {
+  m.def(
+      "put",
+      [](T &out, const Variable &indices, const T &x, const Dim dim) -> T & {
+        return put(out, indices, x, dim);
+      },
+      py::arg("out"), py::arg("indices"), py::arg("x"), py::arg("dim"),
+      py::call_guard<py::gil_scoped_release>(),
+      py::return_value_policy::reference_internal);
+}
+
+void bind_argsort(py::module &m) {
+  m.def(
+      "argsort",
+      [](const Variable &key, const std::string &order) {
+        return argsort(key, get_sort_order(order));
+      },
+      py::arg("key"), py::arg("order") = "ascending",
+      py::call_guard<py::gil_scoped_release>());
+}
+
 void bind_issorted(py::module &m) {
   m.def(
       "issorted",
@@ -72,6 +96,13 @@ void init_operations(py::module &m) {
   bind_sort_dim<Variable>(m);
   bind_sort_dim<DataArray>(m);
   bind_sort_dim<Dataset>(m);
+  bind_argsort(m);
+  bind_take<Variable>(m);
+  bind_take<DataArray>(m);
+  bind_take<Dataset>(m);
+  bind_put<Variable>(m);
+  bind_put<DataArray>(m);
+  bind_put<Dataset>(m);
   bind_issorted(m);
 
   m.def(
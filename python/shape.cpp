@@ -30,7 +30,8 @@ template <class T> void bind_broadcast(py::module &m) {
         Dimensions dims(labels, shape);
         return broadcast(self, dims);
       },
-      py::arg("x"), py::arg("dims"), py::arg("shape"));
+      py::arg("x"), py::arg("dims"), py::arg("shape"),
+      py::call_guard<py::gil_scoped_release>());
 }
 
 template <class T> void bind_concatenate(py::module &m) {
@@ -70,7 +71,8 @@ template <class T> void bind_transpose(pybind11::module &mod) {
       [](const T &self, const std::vector<Dim> &dims) {
         return transpose(self, dims);
       },
-      py::arg("x"), py::arg("dims") = std::vector<Dim>{});
+      py::arg("x"), py::arg("dims") = std::vector<Dim>{},
+      py::call_guard<py::gil_scoped_release>());
 }
 } // namespace
 
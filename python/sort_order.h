@@ -0,0 +1,19 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @author Simon Heybrock
+#pragma once
+
+#include <stdexcept>
+#include <string>
+
+#include "scipp/core/flags.h"
+
+inline auto get_sort_order(const std::string &order) {
+  if (order == "ascending")
+    return scipp::SortOrder::Ascending;
+  else if (order == "descending")
+    return scipp::SortOrder::Descending;
+  else
+    throw std::runtime_error("Sort order must be 'ascending' or 'descending'");
+}
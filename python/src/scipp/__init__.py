@@ -50,6 +50,7 @@ from ._scipp.core import BinEdgeError, BinnedDataError, CoordError, \
 # Import submodules
 from ._scipp.core import units, dtype, buckets
 from . import geometry
+from . import streaming
 # Import functions
 from ._scipp.core import choose, logical_and, logical_or, logical_xor, where
 # Import python functions
@@ -89,6 +90,18 @@ setattr(Variable, 'to_hdf5', _to_hdf5)
 setattr(DataArray, 'to_hdf5', _to_hdf5)
 setattr(Dataset, 'to_hdf5', _to_hdf5)
 
+from .compat.dlpack_compat import dlpack as _dlpack, \
+    dlpack_device as _dlpack_device
+
+setattr(Variable, '__dlpack__', _dlpack)
+setattr(Variable, '__dlpack_device__', _dlpack_device)
+
+from ._pickle import reduce_ex as _reduce_ex
+
+setattr(Variable, '__reduce_ex__', _reduce_ex)
+setattr(DataArray, '__reduce_ex__', _reduce_ex)
+setattr(Dataset, '__reduce_ex__', _reduce_ex)
+
 setattr(Variable, 'sizes', property(_make_sizes))
 setattr(DataArray, 'sizes', property(_make_sizes))
 setattr(Dataset, 'sizes', property(_make_sizes))
@@ -98,6 +98,24 @@ class Bins:
         """
         return _call_cpp_func(_cpp.buckets.sum, self._obj)
 
+    def sort(self,
+             key: str,
+             order: str = 'ascending') -> Union[_cpp.Variable, _cpp.DataArray]:
+        """Sort the contents of each bin by a coordinate of the bins.
+
+        All columns of the bins are reordered consistently. The sort is
+        stable. If all bins are sorted already the input is returned
+        unchanged.
+
+        :param key: Name of the coordinate of the bins to sort by.
+        :param order: Sort order, ``'ascending'`` or ``'descending'``.
+        :raises: If the bins have no coordinates or if the key is not a 1D
+          coordinate of the bins.
+        :return: Binned data with sorted bins.
+        :seealso: :py:func:`scipp.sort` for sorting non-bin data
+        """
+        return _call_cpp_func(_cpp.buckets.sort, self._obj, key, order)
+
     def size(self) -> Union[_cpp.Variable, _cpp.DataArray]:
         """Number of events or elements in a bin.
 
@@ -62,6 +62,64 @@ def sort(x: VariableLike,
     return _call_cpp_func(_cpp.sort, x, key, order)
 
 
+def argsort(key: _cpp.Variable,
+            order: Optional[str] = 'ascending') -> _cpp.Variable:
+    """Return the indices that would sort a 1D variable.
+
+    The sort is stable, i.e., equal elements keep their relative order.
+    NaN values are placed at the end when sorting in ascending order and at
+    the beginning when sorting in descending order.
+
+    :param key: 1D variable to compute the sort order for.
+    :param order: Sorting order. Valid options are 'ascending' and
+      'descending'. Default is 'ascending'.
+    :raises: If the key is invalid, e.g., if it does not have
+      exactly one dimension, or if its dtype is not sortable.
+    :return: Variable of dtype int64 containing the sorting indices.
+    :seealso: :py:func:`scipp.take`, :py:func:`scipp.sort`.
+    """
+    return _call_cpp_func(_cpp.argsort, key, order)
+
+
+def take(x: VariableLike, indices: _cpp.Variable, dim: str) -> VariableLike:
+    """Return slices of the input along a dimension, selected by indices.
+
+    Coords, masks, and attributes depending on ``dim`` are taken as well.
+    Indices may be repeated and do not need to be sorted.
+
+    :param x: Input data.
+    :param indices: 1D variable of dtype int64 with the indices of the slices.
+    :param dim: Dimension along which slices are taken.
+    :raises: If an index is out of range or if a coordinate contains
+      bin-edges along ``dim``.
+    :return: New object containing the selected slices in order of
+      ``indices``.
+    :seealso: :py:func:`scipp.argsort`, :py:func:`scipp.put`.
+    """
+    return _call_cpp_func(_cpp.take, x, indices, dim)
+
+
+def put(out: VariableLike, indices: _cpp.Variable, x: VariableLike,
+        dim: str) -> VariableLike:
+    """Set slices of the output along a dimension, selected by indices.
+
+    This is the inverse of :py:func:`scipp.take`: The ``i``-th slice of ``x``
+    along ``dim`` is written to slice ``indices[i]`` of ``out``. Coords, masks,
+    and attributes of ``out`` depending on ``dim`` are set as well.
+
+    :param out: Output data, modified in-place.
+    :param indices: 1D variable of dtype int64 with the indices of the slices.
+      Indices must be unique.
+    :param x: Input data with the same extent along ``dim`` as ``indices``.
+    :param dim: Dimension along which slices are set.
+    :raises: If an index is out of range or duplicate, or if the input is
+      incompatible with the output.
+    :return: ``out``.
+    :seealso: :py:func:`scipp.take`.
+    """
+    return _call_cpp_func(_cpp.put, out, indices, x, dim)
+
+
 def values(x: VariableLike) -> VariableLike:
     """Return the object without variances.
 
@@ -0,0 +1,52 @@
+# SPDX-License-Identifier: BSD-3-Clause
+# Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+# @file
+# @author Simon Heybrock
+"""
+Pickle support for Variable, DataArray, and Dataset.
+
+Objects are described in the same way as in the raw binary container format,
+see :py:mod:`scipp.io.raw`, but buffers are passed to pickle separately. With
+pickle protocol 5 they are handed out as :py:class:`pickle.PickleBuffer`, so
+they can be transferred out-of-band without copy, e.g., via shared memory.
+"""
+
+import pickle
+
+from .io.raw import _Reader, _Writer
+
+
+class _PickleWriter(_Writer):
+    def add_buffer(self, array):
+        import numpy as np
+        array = np.ascontiguousarray(array)
+        self.buffers.append(array)
+        return {
+            'index': len(self.buffers) - 1,
+            'dtype': array.dtype.str,
+            'shape': list(array.shape)
+        }
+
+
+class _PickleReader(_Reader):
+    def get_buffer(self, desc):
+        import numpy as np
+        # Out-of-band buffers are used without copy. Variables referencing
+        # read-only buffers are read-only, as NumPy arrays in this case.
+        return np.frombuffer(self.buffer[desc['index']],
+                             dtype=desc['dtype']).reshape(desc['shape'])
+
+
+def _unpickle(desc, buffers):
+    return _PickleReader(buffers).read(desc)
+
+
+def reduce_ex(self, protocol):
+    writer = _PickleWriter()
+    desc = writer.write(self)
+    if protocol >= 5:
+        buffers = tuple(pickle.PickleBuffer(b) for b in writer.buffers)
+    else:
+        # NumPy arrays are pickled as a copy of their data.
+        buffers = tuple(writer.buffers)
+    return _unpickle, (desc, buffers)
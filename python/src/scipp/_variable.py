@@ -278,7 +278,8 @@ def array(*,
           values: _ArrayLike,
           variances: _Optional[_ArrayLike] = None,
           unit: _Union[_cpp.Unit, str] = _cpp.units.dimensionless,
-          dtype: type(_cpp.dtype.float64) = None) -> _cpp.Variable:
+          dtype: type(_cpp.dtype.float64) = None,
+          copy: bool = True) -> _cpp.Variable:
     """Constructs a :class:`Variable` with given dimensions, containing given
     values and optional variances. Dimension and value shape must match.
     Only keyword arguments accepted.
@@ -293,6 +294,8 @@ def array(*,
     :param unit: Optional, data unit. Default=dimensionless
     :param dtype: Optional, type of underlying data. Default=None,
       in which case type is inferred from value input.
+    :param copy: Optional, if False, share the memory of NumPy arrays given
+      as values and variances instead of copying where possible. Default=True
     """
     if not dims:
         raise ValueError("The dims of an array must not be empty. "
@@ -301,7 +304,8 @@ def array(*,
                          values=values,
                          variances=variances,
                          unit=unit,
-                         dtype=dtype)
+                         dtype=dtype,
+                         copy=copy)
 
 
 def linspace(dim: str,
@@ -414,6 +418,15 @@ def arange(dim: str,
     if stop is None:
         stop = start
         start = 0
+    args = (start, stop, step)
+    if dtype is None and all(
+            isinstance(x, (int, float)) and not isinstance(x, bool)
+            for x in args):
+        # Values are generated on demand instead of being stored.
+        dtype = _cpp.dtype.int64 if all(isinstance(x, int)
+                                        for x in args) else _cpp.dtype.float64
+        return _cpp.arange(dim,
+                           *(scalar(x, unit=unit, dtype=dtype) for x in args))
     return array(dims=[dim],
                  values=_np.arange(start, stop, step),
                  unit=unit,
@@ -0,0 +1,296 @@
+# SPDX-License-Identifier: BSD-3-Clause
+# Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+# @file
+# @author Simon Heybrock
+
+from __future__ import annotations
+
+from typing import Union, TYPE_CHECKING
+
+import numpy as np
+
+from .. import Dataset, DataArray, Variable, VariableLike
+from .._scipp import core as sc
+
+if TYPE_CHECKING:
+    import pyarrow as pa
+
+# Keys of the unit in the metadata of Arrow fields and of the type of the
+# scipp object in the metadata of tables.
+_unit_key = b'scipp-unit'
+_type_key = b'scipp-type'
+
+
+def _contiguous_values(values):
+    # Arrow cannot represent strides, slices are copied.
+    return np.ascontiguousarray(values)
+
+
+def _variable_to_arrow(var: Variable) -> pa.Array:
+    import pyarrow as pa
+    if len(var.dims) != 1:
+        raise sc.DimensionError(
+            f"Only 1-D variables can be converted to Arrow, got {var.dims}.")
+    if sc.is_bins(var):
+        return _binned_to_arrow(var)
+    if var.dtype == sc.dtype.string:
+        return pa.array(list(var.values), type=pa.string())
+    if var.dtype not in [
+            sc.dtype.float64, sc.dtype.float32, sc.dtype.int64,
+            sc.dtype.int32, sc.dtype.bool, sc.dtype.datetime64
+    ]:
+        raise TypeError(
+            f"Converting dtype={var.dtype} to Arrow is not supported.")
+    # Primitive NumPy arrays are wrapped by Arrow without copy. The arrays
+    # returned by `values` keep the variable and its buffer alive.
+    values = pa.array(_contiguous_values(var.values))
+    if var.variances is None:
+        return values
+    variances = pa.array(_contiguous_values(var.variances))
+    return pa.StructArray.from_arrays([values, variances],
+                                      names=['values', 'variances'])
+
+
+def _binned_to_arrow(var: Variable) -> pa.Array:
+    import pyarrow as pa
+    constituents = var.bins.constituents
+    begin = constituents['begin'].values
+    end = constituents['end'].values
+    if len(begin) > 0 and not np.array_equal(begin[1:], end[:-1]):
+        # Arrow lists are defined by offsets, i.e., bins must be contiguous.
+        var = sc.buckets.compact(var)
+        constituents = var.bins.constituents
+        begin = constituents['begin'].values
+        end = constituents['end'].values
+    offsets = np.empty(len(begin) + 1, dtype=np.int64)
+    offsets[:-1] = begin
+    offsets[-1] = end[-1] if len(end) > 0 else 0
+    first = int(offsets[0])
+    offsets -= first
+    dim = constituents['dim']
+    content = constituents['data'][dim, first:first + int(offsets[-1])]
+    if isinstance(content, Variable):
+        values = _variable_to_arrow(content)
+    else:
+        values = _table_to_struct_array(content)
+    # The name of the list items is used to store the dim of the events.
+    return pa.LargeListArray.from_arrays(pa.array(offsets),
+                                         values,
+                                         type=pa.large_list(
+                                             pa.field(dim, values.type)))
+
+
+def _unit_of(var: Variable):
+    # Bins have no unit, the unit of variables in bins is stored instead.
+    # Units of data arrays in bins are stored in the fields of the struct.
+    if sc.is_bins(var):
+        content = var.bins.constituents['data']
+        if isinstance(content, Variable):
+            return content.unit
+        return sc.units.dimensionless
+    return var.unit
+
+
+def _field(name, var, role=None):
+    import pyarrow as pa
+    array = _variable_to_arrow(var)
+    metadata = {_unit_key: str(_unit_of(var)).encode('utf-8')}
+    if role is not None:
+        metadata[b'scipp-role'] = role.encode('utf-8')
+    return pa.field(name, array.type, metadata=metadata), array
+
+
+def _columns(da: DataArray, dim):
+    name = da.name if da.name else 'data'
+    fields = [_field(name, da.data)]
+    for role, view in [('coord', da.coords), ('mask', da.masks),
+                       ('attr', da.attrs)]:
+        for key in view:
+            if view[key].dims == [dim]:
+                fields.append(_field(str(key), view[key], role))
+            else:
+                raise sc.DimensionError(
+                    f"Cannot convert {role} '{key}' with dims "
+                    f"{view[key].dims} to an Arrow column.")
+    return fields
+
+
+def _table_to_struct_array(da: DataArray) -> pa.Array:
+    import pyarrow as pa
+    fields = _columns(da, da.dims[0])
+    return pa.StructArray.from_arrays([array for _, array in fields],
+                                      fields=[field for field, _ in fields])
+
+
+def to_arrow(obj: VariableLike) -> Union[pa.Array, pa.Table]:
+    """
+    Converts a 1-D scipp object to Arrow.
+
+    Variables are converted to an Arrow array. Since arrays cannot store a
+    unit, only dimensionless variables are supported. Data arrays are
+    converted to an Arrow table with a column for the data and each coord,
+    mask, and attr. Datasets are converted to a table with a column for each
+    item and coord, masks and attrs of items are not converted. All coords,
+    masks, and attrs must depend on the dimension of the table only, 0-D
+    entries cannot be represented as columns.
+    Units are stored in the metadata of the table fields. Variances are
+    represented as a struct array with fields ``values`` and ``variances``.
+    Binned variables are converted to list arrays based on the bin indices.
+
+    Buffers of numeric dtype are shared with Arrow if they are contiguous, so
+    the conversion does not copy data. The scipp object is kept alive by the
+    Arrow buffers.
+
+    :param obj: The 1-D variable, data array, or dataset to convert.
+    :raises: If a variable has a unit, or if a coord, mask, or attr does not
+      depend on exactly the dimension of the table.
+    :return: An Arrow array for variables, an Arrow table otherwise.
+    """
+    import pyarrow as pa
+    if isinstance(obj, Variable):
+        if _unit_of(obj) != sc.units.dimensionless:
+            raise sc.UnitError(
+                f"Arrow arrays cannot store the unit {_unit_of(obj)}. "
+                "Convert a data array to store units in the table.")
+        return _variable_to_arrow(obj)
+    if len(obj.dims) != 1:
+        raise sc.DimensionError(
+            f"Only 1-D objects can be converted to Arrow, got {obj.dims}.")
+    if isinstance(obj, DataArray):
+        fields = _columns(obj, obj.dims[0])
+    elif isinstance(obj, Dataset):
+        fields = []
+        for name in obj:
+            fields.append(_field(name, obj[name].data))
+        for key in obj.coords:
+            if obj.coords[key].dims != obj.dims:
+                raise sc.DimensionError(
+                    f"Cannot convert coord '{key}' with dims "
+                    f"{obj.coords[key].dims} to an Arrow column.")
+            fields.append(_field(str(key), obj.coords[key], 'coord'))
+    else:
+        raise TypeError(f"Cannot convert {type(obj)} to Arrow.")
+    schema = pa.schema([field for field, _ in fields],
+                       metadata={_type_key: type(obj).__name__})
+    return pa.Table.from_arrays([array for _, array in fields], schema=schema)
+
+
+def _array_to_numpy(array):
+    import pyarrow as pa
+    if array.null_count != 0:
+        raise ValueError("Arrow arrays with nulls are not supported.")
+    if pa.types.is_string(array.type) or pa.types.is_large_string(
+            array.type):
+        return np.array(array.to_pylist(), dtype=object)
+    # Zero-copy for primitive types except bool. The result is read-only.
+    return array.to_numpy(zero_copy_only=False)
+
+
+def _variable_from_arrow(array, dim, unit) -> Variable:
+    import pyarrow as pa
+    if isinstance(array, pa.ChunkedArray):
+        # Only single chunks can be used without copy.
+        if array.num_chunks == 1:
+            array = array.chunk(0)
+        else:
+            array = pa.concat_arrays(array.chunks)
+    if pa.types.is_list(array.type) or pa.types.is_large_list(array.type):
+        offsets = _array_to_numpy(array.offsets).astype(np.int64)
+        begin = Variable(dims=[dim], values=offsets[:-1])
+        end = Variable(dims=[dim], values=offsets[1:])
+        values = array.values
+        inner_dim = array.type.value_field.name
+        if pa.types.is_struct(values.type) and values.type.get_field_index(
+                'variances') == -1:
+            content = _data_array_from_struct(values, inner_dim)
+        else:
+            content = _variable_from_arrow(values, inner_dim, unit)
+        return sc.bins(begin=begin, end=end, dim=inner_dim, data=content)
+    if pa.types.is_struct(array.type):
+        return Variable(dims=[dim],
+                        values=_array_to_numpy(array.field('values')),
+                        variances=_array_to_numpy(array.field('variances')),
+                        unit=unit,
+                        copy=False)
+    values = _array_to_numpy(array)
+    if pa.types.is_timestamp(array.type):
+        return Variable(dims=[dim], values=values)
+    return Variable(dims=[dim], values=values, unit=unit, copy=False)
+
+
+def _unit(field):
+    if field.metadata is None or _unit_key not in field.metadata:
+        return sc.units.dimensionless
+    return sc.Unit(field.metadata[_unit_key].decode('utf-8'))
+
+
+def _role(field):
+    if field.metadata is None:
+        return None
+    role = field.metadata.get(b'scipp-role')
+    return None if role is None else role.decode('utf-8')
+
+
+def _data_array_from_columns(fields, columns, dim):
+    data = None
+    categories = {'coord': {}, 'mask': {}, 'attr': {}}
+    for field, column in zip(fields, columns):
+        var = _variable_from_arrow(column, dim, _unit(field))
+        role = _role(field)
+        if role is None:
+            data = var
+            name = field.name
+        else:
+            categories[role][field.name] = var
+    return DataArray(data=data,
+                     name=name,
+                     coords=categories['coord'],
+                     masks=categories['mask'],
+                     attrs=categories['attr'])
+
+
+def _data_array_from_struct(array, dim):
+    fields = list(array.type)
+    return _data_array_from_columns(
+        fields, [array.field(i) for i in range(len(fields))], dim)
+
+
+def from_arrow(obj: Union[pa.Array, pa.ChunkedArray, pa.Table],
+               dim: str = 'row') -> VariableLike:
+    """
+    Converts an Arrow array or table to scipp.
+
+    Arrays are converted to variables, list arrays to binned variables. Tables
+    created from a data array by :py:func:`scipp.compat.arrow_compat.to_arrow`
+    are converted back to a data array. Other tables are converted to a
+    dataset, with a coord for each column marked as coord and an item for
+    every other column.
+
+    Buffers of numeric dtype other than bool are used without copy if the
+    array has a single chunk. Since Arrow buffers are immutable, the resulting
+    variables are read-only. This includes binned variables referencing such
+    buffers.
+
+    :param obj: The Arrow array or table to convert.
+    :param dim: Dimension label of the rows. Default='row'
+    :return: A variable for arrays, a data array or dataset for tables.
+    """
+    import pyarrow as pa
+    if isinstance(obj, (pa.Array, pa.ChunkedArray)):
+        return _variable_from_arrow(obj, dim, sc.units.dimensionless)
+    if not isinstance(obj, pa.Table):
+        raise TypeError(f"Cannot convert {type(obj)} from Arrow.")
+    fields = list(obj.schema)
+    columns = [obj.column(i) for i in range(obj.num_columns)]
+    metadata = obj.schema.metadata
+    if metadata is not None and metadata.get(_type_key) == b'DataArray':
+        return _data_array_from_columns(fields, columns, dim)
+    items = {}
+    coords = {}
+    for field, column in zip(fields, columns):
+        var = _variable_from_arrow(column, dim, _unit(field))
+        if _role(field) == 'coord':
+            coords[field.name] = var
+        else:
+            items[field.name] = var
+    return Dataset(data=items, coords=coords)
@@ -0,0 +1,62 @@
+# SPDX-License-Identifier: BSD-3-Clause
+# Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+# @file
+# @author Simon Heybrock
+
+from __future__ import annotations
+
+from typing import Any, Sequence, Union
+
+import numpy as np
+
+from .. import Variable
+from .._scipp import core as sc
+
+
+def _dense_values(var: Variable) -> np.ndarray:
+    if var.variances is not None:
+        raise sc.VariancesError(
+            "DLPack cannot represent variances, use `var.values` to export "
+            "only the values.")
+    if var.dtype not in [
+            sc.dtype.float64, sc.dtype.float32, sc.dtype.int64,
+            sc.dtype.int32, sc.dtype.bool
+    ]:
+        raise TypeError(f"DLPack does not support dtype={var.dtype}.")
+    # The array references the memory of the variable and keeps it alive.
+    return var.values if var.dims else np.asarray(var.value)
+
+
+def dlpack(self: Variable, stream: Any = None):
+    """
+    Export the values of a variable as a DLPack capsule without copy.
+
+    This implements the array API protocol and requires NumPy 1.22 or later.
+    Use, e.g., ``numpy.from_dlpack(var)`` to consume the variable. Variables
+    with variances cannot be exported.
+    """
+    return _dense_values(self).__dlpack__(stream=stream)
+
+
+def dlpack_device(self: Variable):
+    """
+    Return the DLPack device type and ID of the variable's memory.
+    """
+    return _dense_values(self).__dlpack_device__()
+
+
+def from_dlpack(
+        x: Any,
+        dims: Sequence[str],
+        unit: Union[sc.Unit, str] = sc.units.dimensionless) -> Variable:
+    """
+    Creates a variable from an object supporting the DLPack protocol.
+
+    The memory of `x` is used without copy if it is supported by
+    :py:class:`scipp.Variable` with ``copy=False``.
+
+    :param x: Object implementing ``__dlpack__``, e.g., a NumPy array.
+    :param dims: Dimension labels.
+    :param unit: Optional, unit. Default=dimensionless
+    """
+    return Variable(dims=dims, values=np.from_dlpack(x), unit=unit, copy=False)
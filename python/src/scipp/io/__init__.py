@@ -6,3 +6,5 @@
 # flake8: noqa
 
 from .hdf5 import open_hdf5
+from .raw import open_raw, to_raw
+from .shared_memory import open_shared_memory, to_shared_memory
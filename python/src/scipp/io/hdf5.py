@@ -5,7 +5,7 @@
 
 from __future__ import annotations
 from pathlib import Path
-from typing import Union
+from typing import Dict, Optional, Union
 
 from ..typing import VariableLike
 
@@ -31,68 +31,144 @@ def _as_hdf5_type(a):
     return a
 
 
+def _create_dataset(group, name, data, options):
+    """
+    Create a dataset, applying chunking and compression `options` unless the
+    data is a scalar or empty, which HDF5 cannot chunk.
+    """
+    if options and data.ndim > 0 and data.size > 0:
+        return group.create_dataset(name, data=data, **options)
+    return group.create_dataset(name, data=data)
+
+
+def _index_range(index, size):
+    """
+    Return the range [start, stop) of indices along a dim of given size
+    selected by an integer or a slice without step.
+    """
+    if isinstance(index, slice):
+        if index.step not in (None, 1):
+            raise ValueError("Selections with a step are not supported.")
+        start, stop, _ = index.indices(size)
+        return start, max(start, stop)
+    if index < -size or index >= size:
+        raise IndexError(f"Index {index} is out of range for dim of "
+                         f"size {size}.")
+    index = index % size
+    return index, index + 1
+
+
+def _hyperslab(dims, shape, selection, sizes):
+    """
+    Return a tuple of slices to read along `dims`, or None if nothing is
+    selected along any of them.
+
+    `sizes` holds the extents of the data the variable belongs to. Variables
+    exceeding these by 1 are bin-edges and include the upper edge.
+    """
+    if not selection or not any(dim in selection for dim in dims):
+        return None
+    sizes = {} if sizes is None else sizes
+    hyperslab = []
+    for dim, extent in zip(dims, shape):
+        if dim in selection:
+            start, stop = _index_range(selection[dim],
+                                       sizes.get(dim, extent))
+            if extent == sizes.get(dim, extent) + 1:
+                stop += 1
+            hyperslab.append(slice(start, stop))
+        else:
+            hyperslab.append(slice(0, extent))
+    return tuple(hyperslab)
+
+
+def _apply_hyperslab(var, hyperslab):
+    for dim, s in zip(var.dims, hyperslab):
+        var = var[dim, s]
+    return var
+
+
 class NumpyDataIO:
     @staticmethod
-    def write(group, data):
-        dset = group.create_dataset('values', data=_as_hdf5_type(data.values))
+    def write(group, data, options=None):
+        dset = _create_dataset(group, 'values', _as_hdf5_type(data.values),
+                               options)
         if data.variances is not None:
-            variances = group.create_dataset('variances', data=data.variances)
+            variances = _create_dataset(group, 'variances', data.variances,
+                                        options)
             dset.attrs['variances'] = variances.ref
         return dset
 
     @staticmethod
-    def read(group, data):
+    def read(group, data, hyperslab=None):
+        # Only the selected hyperslab is read, i.e., only chunks overlapping
+        # with it are loaded and decompressed.
         if (data.values.flags['C_CONTIGUOUS']):
-            group['values'].read_direct(_as_hdf5_type(data.values))
-        else:
+            group['values'].read_direct(_as_hdf5_type(data.values),
+                                        source_sel=hyperslab)
+        elif hyperslab is None:
             # Values of Eigen matrices are transposed
             data.values = group['values']
+        else:
+            data.values = group['values'][hyperslab]
         if 'variances' in group:
-            group['variances'].read_direct(data.variances)
+            group['variances'].read_direct(data.variances,
+                                           source_sel=hyperslab)
 
 
 class BinDataIO:
     @staticmethod
-    def write(group, data):
-        from .. import sum as sc_sum
+    def write(group, data, options=None):
+        from .._scipp import core as sc
+        # Avoid writing large buffers, e.g., from overallocation or when
+        # writing a slice of a larger variable. `compact` copies only the
+        # referenced events, or nothing if the bins cover a contiguous range
+        # of the buffer, as is the case for slices of compact data.
+        if sc.buckets.fill_ratio(data) < 1.0 / 1.5:
+            data = sc.buckets.compact(data)
         bins = data.bins.constituents
-        buffer_len = bins['data'].sizes[bins['dim']]
-        # Crude mechanism to avoid writing large buffers, e.g., from
-        # overallocation or when writing a slice of a larger variable. The
-        # copy causes some overhead, but so would the (much mor complicated)
-        # solution to extract contents bin-by-bin. This approach will likely
-        # need to be revisited in the future.
-        if buffer_len > 1.5 * sc_sum(data.bins.size()).value:
-            data = data.copy()
-            bins = data.bins.constituents
         values = group.create_group('values')
-        VariableIO.write(values.create_group('begin'), var=bins['begin'])
-        VariableIO.write(values.create_group('end'), var=bins['end'])
+        VariableIO.write(values.create_group('begin'),
+                         var=bins['begin'],
+                         options=options)
+        VariableIO.write(values.create_group('end'),
+                         var=bins['end'],
+                         options=options)
         data_group = values.create_group('data')
         data_group.attrs['dim'] = bins['dim']
-        HDF5IO.write(data_group, bins['data'])
+        HDF5IO.write(data_group, bins['data'], options=options)
         return values
 
     @staticmethod
-    def read(group):
+    def read(group, hyperslab=None):
         from .._scipp import core as sc
         values = group['values']
-        begin = VariableIO.read(values['begin'])
-        end = VariableIO.read(values['end'])
+        begin = VariableIO.read_hyperslab(values['begin'], hyperslab)
+        end = VariableIO.read_hyperslab(values['end'], hyperslab)
         dim = values['data'].attrs['dim']
-        data = HDF5IO.read(values['data'])
+        selection = None
+        if hyperslab is not None:
+            # Read only the range of the buffer referenced by selected bins.
+            lo = int(begin.values.min()) if begin.values.size else 0
+            hi = int(end.values.max()) if end.values.size else 0
+            selection = {dim: slice(lo, max(lo, hi))}
+            begin.values -= lo
+            end.values -= lo
+        data = HDF5IO.read(values['data'], selection=selection)
         return sc.bins(begin=begin, end=end, dim=dim, data=data)
 
 
 class ScippDataIO:
     @staticmethod
-    def write(group, data):
+    def write(group, data, options=None):
         values = group.create_group('values')
         if len(data.shape) == 0:
-            HDF5IO.write(values, data.value)
+            HDF5IO.write(values, data.value, options=options)
         else:
             for i, item in enumerate(data.values):
-                HDF5IO.write(values.create_group(f'value-{i}'), item)
+                HDF5IO.write(values.create_group(f'value-{i}'),
+                             item,
+                             options=options)
         return values
 
     @staticmethod
@@ -107,10 +183,15 @@ class ScippDataIO:
 
 class StringDataIO:
     @staticmethod
-    def write(group, data):
+    def write(group, data, options=None):
         import h5py
         dt = h5py.string_dtype(encoding='utf-8')
-        dset = group.create_dataset('values', shape=data.shape, dtype=dt)
+        if not options or len(data.shape) == 0 or 0 in data.shape:
+            options = {}
+        dset = group.create_dataset('values',
+                                    shape=data.shape,
+                                    dtype=dt,
+                                    **options)
         if len(data.shape) == 0:
             dset[()] = data.value
         else:
@@ -165,22 +246,22 @@ class VariableIO:
     _data_handlers = _data_handler_lut()
 
     @classmethod
-    def _write_data(cls, group, data):
-        return cls._data_handlers[str(data.dtype)].write(group, data)
+    def _write_data(cls, group, data, options):
+        return cls._data_handlers[str(data.dtype)].write(group, data, options)
 
     @classmethod
     def _read_data(cls, group, data):
         return cls._data_handlers[str(data.dtype)].read(group, data)
 
     @classmethod
-    def write(cls, group, var):
+    def write(cls, group, var, options=None):
         if var.dtype not in cls._dtypes.values():
             # In practice this may make the file unreadable, e.g., if values
             # have unsupported dtype.
             print(f'Writing with dtype={var.dtype} not implemented, skipping.')
             return
         _write_scipp_header(group, 'Variable')
-        dset = cls._write_data(group, var)
+        dset = cls._write_data(group, var, options)
         dset.attrs['dims'] = [str(dim) for dim in var.dims]
         dset.attrs['shape'] = var.shape
         dset.attrs['dtype'] = str(var.dtype)
@@ -188,7 +269,15 @@ class VariableIO:
         return group
 
     @classmethod
-    def read(cls, group):
+    def read(cls, group, selection=None, sizes=None):
+        _check_scipp_header(group, 'Variable')
+        values = group['values']
+        hyperslab = _hyperslab(values.attrs['dims'], values.attrs['shape'],
+                               selection, sizes)
+        return cls.read_hyperslab(group, hyperslab)
+
+    @classmethod
+    def read_hyperslab(cls, group, hyperslab):
         _check_scipp_header(group, 'Variable')
         from .._scipp import core as sc
         from .._scipp.core import dtype as d
@@ -200,21 +289,32 @@ class VariableIO:
         if contents['dtype'] in [
                 d.VariableView, d.DataArrayView, d.DatasetView
         ]:
-            var = BinDataIO.read(group)
-        else:
+            var = BinDataIO.read(group, hyperslab)
+        elif hyperslab is None:
             var = sc.empty(**contents)
             cls._read_data(group, var)
+        elif cls._data_handlers[str(contents['dtype'])] is NumpyDataIO:
+            contents['shape'] = [s.stop - s.start for s in hyperslab]
+            var = sc.empty(**contents)
+            if 0 not in contents['shape']:
+                NumpyDataIO.read(group, var, hyperslab)
+        else:
+            # Strings and nested containers are read fully and sliced.
+            var = cls.read_hyperslab(group, None)
+            var = _apply_hyperslab(var, hyperslab).copy()
         return var
 
 
 class DataArrayIO:
     @staticmethod
-    def write(group, data):
+    def write(group, data, options=None):
         _write_scipp_header(group, 'DataArray')
         group.attrs['name'] = data.name
         if data.data is None:
             raise RuntimeError("Cannot write object with invalid data.")
-        VariableIO.write(group.create_group('data'), var=data.data)
+        VariableIO.write(group.create_group('data'),
+                         var=data.data,
+                         options=options)
         views = [data.coords, data.masks, data.attrs]
         # Note that we write aligned and unaligned coords into the same group.
         # Distinction is via an attribute, which is more natural than having
@@ -223,43 +323,49 @@ class DataArrayIO:
             subgroup = group.create_group(view_name)
             for name in view:
                 g = VariableIO.write(group=subgroup.create_group(str(name)),
-                                     var=view[name])
+                                     var=view[name],
+                                     options=options)
                 if g is None:
                     del subgroup[str(name)]
 
     @staticmethod
-    def read(group):
+    def read(group, selection=None):
         _check_scipp_header(group, 'DataArray')
         from .._scipp import core as sc
+        values = group['data']['values']
+        sizes = dict(zip(values.attrs['dims'], values.attrs['shape']))
         contents = dict()
         contents['name'] = group.attrs['name']
-        contents['data'] = VariableIO.read(group['data'])
+        contents['data'] = VariableIO.read(group['data'], selection, sizes)
         for category in ['coords', 'masks', 'attrs']:
             contents[category] = dict()
             for name in group[category]:
                 g = group[category][name]
-                contents[category][name] = VariableIO.read(g)
+                contents[category][name] = VariableIO.read(
+                    g, selection, sizes)
         return sc.DataArray(**contents)
 
 
 class DatasetIO:
     @staticmethod
-    def write(group, data):
+    def write(group, data, options=None):
         _write_scipp_header(group, 'Dataset')
         # Slight redundancy here from writing aligned coords for each item,
         # but irrelevant for common case of 1D coords with 2D (or higher)
         # data. The advantage is the we can read individual dataset entries
         # directly as data arrays.
         for name in data:
-            HDF5IO.write(group.create_group(name), data[name])
+            HDF5IO.write(group.create_group(name), data[name], options=options)
 
     @staticmethod
-    def read(group):
+    def read(group, selection=None):
         _check_scipp_header(group, 'Dataset')
         from .._scipp import core as sc
         return sc.Dataset(
-            data={name: HDF5IO.read(group[name])
-                  for name in group})
+            data={
+                name: HDF5IO.read(group[name], selection=selection)
+                for name in group
+            })
 
 
 class HDF5IO:
@@ -268,25 +374,438 @@ class HDF5IO:
             [VariableIO, DataArrayIO, DatasetIO]))
 
     @classmethod
-    def write(cls, group, data):
+    def write(cls, group, data, options=None):
         name = data.__class__.__name__.replace('View', '')
-        return cls._handlers[name].write(group, data)
+        return cls._handlers[name].write(group, data, options=options)
 
     @classmethod
-    def read(cls, group):
-        return cls._handlers[group.attrs['scipp-type']].read(group)
+    def read(cls, group, selection=None):
+        return cls._handlers[group.attrs['scipp-type']].read(
+            group, selection=selection)
 
 
-def to_hdf5(obj: VariableLike, filename: Union[str, Path]):
+def to_hdf5(obj: VariableLike,
+            filename: Union[str, Path],
+            *,
+            compression: Optional[str] = None,
+            compression_opts=None,
+            chunks: Optional[bool] = None):
     """
     Writes object out to file in hdf5 format.
+
+    :param obj: Object to write.
+    :param filename: Name of the file to write.
+    :param compression: Optional, compression filter for arrays, e.g., 'gzip'
+      or 'lzf'. Default=None, i.e., no compression.
+    :param compression_opts: Optional, options of the compression filter,
+      e.g., the level for 'gzip'.
+    :param chunks: Optional, if True, store arrays in chunks of automatically
+      determined shape. This is implied by compression. Chunked storage allows
+      for reading a selection with :py:func:`scipp.io.open_hdf5` without
+      reading the remainder of the file.
     """
     import h5py
+    options = {
+        key: value
+        for key, value in zip(['compression', 'compression_opts', 'chunks'],
+                              [compression, compression_opts, chunks])
+        if value is not None
+    }
     with h5py.File(filename, 'w') as f:
-        HDF5IO.write(f, obj)
+        HDF5IO.write(f, obj, options=options)
 
 
-def open_hdf5(filename: Union[str, Path]) -> VariableLike:
+def open_hdf5(filename: Union[str, Path],
+              *,
+              selection: Optional[Dict[str, Union[int, slice]]] = None,
+              lazy: bool = False) -> VariableLike:
+    """
+    Reads an object written by :py:func:`scipp.to_hdf5`.
+
+    :param filename: Name of the file to read.
+    :param selection: Optional, dict of dim labels and integer indices or
+      slices. Only the selected part of the object is read from the file,
+      i.e., ``open_hdf5(filename, selection={'x': slice(2, 4)})`` is
+      equivalent to ``open_hdf5(filename)['x', 2:4]``. For binned data only
+      the events in the selected bins are read.
+    :param lazy: Optional, if True, return a proxy of type
+      :py:class:`LazyVariable`, :py:class:`LazyDataArray`, or
+      :py:class:`LazyDataset` instead of reading the data. Metadata such as
+      dims, units, and dtypes is available immediately, slicing the proxy
+      restricts the range that is read when calling ``load()``.
+      Default=False
+    """
     import h5py
+    if lazy:
+        with h5py.File(filename, 'r') as f:
+            obj = _open_lazy(filename, f)
+        for dim, index in ({} if selection is None else selection).items():
+            if dim in obj.dims:
+                obj = obj[dim, index]
+        return obj
     with h5py.File(filename, 'r') as f:
-        return HDF5IO.read(f)
+        obj = HDF5IO.read(f, selection=selection)
+    for dim, index in ({} if selection is None else selection).items():
+        if not isinstance(index, slice) and dim in obj.dims:
+            obj = obj[dim, 0].copy()
+    return obj
+
+
+def _variable_meta(group):
+    values = group['values']
+    return {
+        'dims': [str(dim) for dim in values.attrs['dims']],
+        'shape': [int(extent) for extent in values.attrs['shape']],
+        'dtype': str(values.attrs['dtype']),
+        'unit': str(values.attrs['unit'])
+    }
+
+
+def _is_label_index(index):
+    from .._scipp import core as sc
+    if isinstance(index, slice):
+        return isinstance(index.start, sc.Variable) or isinstance(
+            index.stop, sc.Variable)
+    return isinstance(index, sc.Variable)
+
+
+def _label_to_position(coord, dim, size, index):
+    """
+    Return the positional index equivalent to the label-based `index` for
+    data of given `size` along `dim`.
+    """
+    import numpy as np
+    from .._scipp import core as sc
+    positions = sc.DataArray(data=sc.Variable(dims=[dim],
+                                              values=np.arange(size)),
+                             coords={dim: coord})
+    selected = positions[dim, index]
+    if not isinstance(index, slice):
+        return int(selected.value)
+    values = selected.values
+    if len(values) == 0:
+        return slice(0, 0)
+    return slice(int(values[0]), int(values[-1]) + 1)
+
+
+class _LazyObject:
+    """
+    Common implementation of proxies of objects in an HDF5 file.
+
+    `selection` maps dims to slices of the full object in the file. Dims in
+    `points` were indexed with an integer and are removed after loading.
+    """
+    def __init__(self, filename, path, full_sizes, selection, points):
+        self._filename = filename
+        self._path = path
+        self._full_sizes = full_sizes
+        self._selection = selection
+        self._points = points
+
+    @property
+    def sizes(self) -> Dict[str, int]:
+        """Dict of dims and extents of the selected data (read-only)."""
+        sizes = {}
+        for dim, extent in self._full_sizes.items():
+            if dim in self._points:
+                continue
+            if dim in self._selection:
+                extent = self._selection[dim].stop - self._selection[dim].start
+            sizes[dim] = extent
+        return sizes
+
+    @property
+    def dims(self):
+        """Dimension labels of the selected data (read-only)."""
+        return list(self.sizes)
+
+    @property
+    def shape(self):
+        """Shape of the selected data (read-only)."""
+        return list(self.sizes.values())
+
+    def _positional(self, dim, index):
+        from .._scipp import core as sc
+        if dim not in self.sizes:
+            raise sc.DimensionError(
+                f"Expected dimension to be in {self.dims}, got {dim}.")
+        start, stop = _index_range(index, self.sizes[dim])
+        offset = self._selection[dim].start if dim in self._selection else 0
+        selection = dict(self._selection)
+        selection[dim] = slice(offset + start, offset + stop)
+        points = self._points
+        if not isinstance(index, slice):
+            points = points + (dim, )
+        return selection, points
+
+    def _read(self, group, selection):
+        raise NotImplementedError()
+
+    def load(self) -> VariableLike:
+        """Read the selected data from the file."""
+        import h5py
+        with h5py.File(self._filename, 'r') as f:
+            obj = self._read(f[self._path], self._selection or None)
+        for dim in self._points:
+            obj = obj[dim, 0].copy()
+        return obj
+
+    def __repr__(self):
+        return (f'<scipp.io.{type(self).__name__} {self.sizes} '
+                f'from {self._filename}:{self._path}>')
+
+
+class LazyVariable(_LazyObject):
+    """
+    Proxy of a variable in an HDF5 file, returned by
+    :py:func:`scipp.io.open_hdf5` with ``lazy=True``.
+
+    Dims, shape, unit, and dtype are available without reading the data.
+    Slicing returns a new proxy, only the selected range is read when calling
+    :py:meth:`load` or accessing values or variances.
+    """
+    def __init__(self,
+                 filename,
+                 path,
+                 meta,
+                 *,
+                 selection=None,
+                 points=(),
+                 data_sizes=None):
+        full_sizes = dict(zip(meta['dims'], meta['shape']))
+        super().__init__(filename, path, full_sizes,
+                         {} if selection is None else selection, points)
+        self._meta = meta
+        self._data_sizes = data_sizes
+
+    def _is_edges(self, dim):
+        return self._data_sizes is not None and dim in self._data_sizes and \
+            self._full_sizes[dim] == self._data_sizes[dim] + 1
+
+    @property
+    def sizes(self) -> Dict[str, int]:
+        sizes = super().sizes
+        for dim in sizes:
+            # The selection refers to the data, bin-edges include the upper
+            # edge.
+            if dim in self._selection and self._is_edges(dim):
+                sizes[dim] += 1
+        return sizes
+
+    def _positional(self, dim, index):
+        selection, points = super()._positional(dim, index)
+        if self._is_edges(dim):
+            # Convert range of edges to range of data.
+            selection[dim] = slice(selection[dim].start,
+                                   selection[dim].stop - 1)
+        return selection, points
+
+    @property
+    def dtype(self):
+        """Type of the elements of the variable (read-only)."""
+        return VariableIO._dtypes[self._meta['dtype']]
+
+    @property
+    def unit(self):
+        """Physical unit of the variable (read-only)."""
+        from .._scipp import core as sc
+        return sc.Unit(self._meta['unit'])
+
+    @property
+    def values(self):
+        """Array of values, reads the selected data."""
+        return self.load().values
+
+    @property
+    def variances(self):
+        """Array of variances, reads the selected data."""
+        return self.load().variances
+
+    @property
+    def value(self):
+        """Value of a 0-D variable, reads the data."""
+        return self.load().value
+
+    def _read(self, group, selection):
+        return VariableIO.read(group, selection, self._data_sizes)
+
+    def __getitem__(self, key):
+        dim, index = key
+        if _is_label_index(index):
+            raise TypeError(
+                "Label-based slicing requires a coord, slice the data array.")
+        selection, points = self._positional(dim, index)
+        return LazyVariable(self._filename,
+                            self._path,
+                            self._meta,
+                            selection=selection,
+                            points=points,
+                            data_sizes=self._data_sizes)
+
+
+class LazyDataArray(_LazyObject):
+    """
+    Proxy of a data array in an HDF5 file, returned by
+    :py:func:`scipp.io.open_hdf5` with ``lazy=True``.
+
+    Data, coords, masks, and attrs are proxies of type
+    :py:class:`LazyVariable`. Slicing, including label-based slicing, returns
+    a new proxy. Label-based slicing reads the corresponding coord.
+    """
+    def __init__(self, filename, path, meta, *, selection=None, points=()):
+        data_meta = meta['data']
+        full_sizes = dict(zip(data_meta['dims'], data_meta['shape']))
+        super().__init__(filename, path, full_sizes,
+                         {} if selection is None else selection, points)
+        self._meta = meta
+
+    @classmethod
+    def _from_group(cls, filename, group):
+        _check_scipp_header(group, 'DataArray')
+        meta = {
+            'name': str(group.attrs['name']),
+            'data': _variable_meta(group['data'])
+        }
+        for category in ['coords', 'masks', 'attrs']:
+            meta[category] = {
+                name: _variable_meta(group[category][name])
+                for name in group[category]
+            }
+        return cls(filename, group.name, meta)
+
+    @property
+    def name(self) -> str:
+        return self._meta['name']
+
+    def _variable(self, path, meta):
+        return LazyVariable(self._filename,
+                            f'{self._path.rstrip("/")}/{path}',
+                            meta,
+                            selection={
+                                dim: s
+                                for dim, s in self._selection.items()
+                                if dim in meta['dims']
+                            },
+                            points=tuple(dim for dim in self._points
+                                         if dim in meta['dims']),
+                            data_sizes=self._full_sizes)
+
+    def _variables(self, category):
+        return {
+            name: self._variable(f'{category}/{name}', meta)
+            for name, meta in self._meta[category].items()
+        }
+
+    @property
+    def data(self) -> LazyVariable:
+        return self._variable('data', self._meta['data'])
+
+    @property
+    def coords(self) -> Dict[str, LazyVariable]:
+        return self._variables('coords')
+
+    @property
+    def masks(self) -> Dict[str, LazyVariable]:
+        return self._variables('masks')
+
+    @property
+    def attrs(self) -> Dict[str, LazyVariable]:
+        return self._variables('attrs')
+
+    @property
+    def dtype(self):
+        return self.data.dtype
+
+    @property
+    def unit(self):
+        return self.data.unit
+
+    def _read(self, group, selection):
+        return DataArrayIO.read(group, selection)
+
+    def __getitem__(self, key):
+        dim, index = key
+        if _is_label_index(index):
+            coords = self.coords
+            if dim not in coords:
+                raise KeyError(f"No coord for dim {dim}.")
+            index = _label_to_position(coords[dim].load(), dim,
+                                       self.sizes[dim], index)
+        selection, points = self._positional(dim, index)
+        return LazyDataArray(self._filename,
+                             self._path,
+                             self._meta,
+                             selection=selection,
+                             points=points)
+
+
+class LazyDataset:
+    """
+    Proxy of a dataset in an HDF5 file, returned by
+    :py:func:`scipp.io.open_hdf5` with ``lazy=True``.
+
+    Items are proxies of type :py:class:`LazyDataArray`.
+    """
+    def __init__(self, items):
+        self._items = items
+
+    def __iter__(self):
+        return iter(self._items)
+
+    def __len__(self):
+        return len(self._items)
+
+    def keys(self):
+        return self._items.keys()
+
+    @property
+    def sizes(self) -> Dict[str, int]:
+        sizes = {}
+        for item in self._items.values():
+            sizes.update(item.sizes)
+        return sizes
+
+    @property
+    def dims(self):
+        return list(self.sizes)
+
+    def __getitem__(self, key):
+        if isinstance(key, str):
+            return self._items[key]
+        dim, index = key
+        if _is_label_index(index):
+            for item in self._items.values():
+                if dim in item.coords:
+                    index = _label_to_position(item.coords[dim].load(), dim,
+                                               item.sizes[dim], index)
+                    break
+            else:
+                raise KeyError(f"No coord for dim {dim}.")
+        return LazyDataset({
+            name: item[dim, index] if dim in item.dims else item
+            for name, item in self._items.items()
+        })
+
+    def load(self):
+        """Read the selected data from the file."""
+        from .._scipp import core as sc
+        return sc.Dataset(
+            data={name: item.load()
+                  for name, item in self._items.items()})
+
+    def __repr__(self):
+        return f'<scipp.io.LazyDataset {self.sizes} {list(self._items)}>'
+
+
+def _open_lazy(filename, group):
+    kind = group.attrs['scipp-type']
+    if kind == 'Variable':
+        _check_scipp_header(group, 'Variable')
+        return LazyVariable(filename, group.name, _variable_meta(group))
+    if kind == 'DataArray':
+        return LazyDataArray._from_group(filename, group)
+    _check_scipp_header(group, 'Dataset')
+    return LazyDataset({
+        name: LazyDataArray._from_group(filename, group[name])
+        for name in group
+    })
@@ -0,0 +1,329 @@
+# SPDX-License-Identifier: BSD-3-Clause
+# Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+# @file
+# @author Simon Heybrock
+"""
+Raw binary container format for fast exchange of data on the same machine.
+
+A file consists of a small JSON header describing dims, shapes, units and
+dtypes, followed by the raw buffers of values, variances, and bin indices,
+each aligned to 64 bytes. Files are memory-mapped when opened and variables
+with numeric dtype reference the mapped buffers directly, i.e., opening a file
+neither parses nor copies the data. Buffers are mapped copy-on-write, so
+modifying the loaded objects does not modify the file.
+
+The layout uses the native byte order and is not meant for archiving. Use
+:py:func:`scipp.to_hdf5` for that purpose.
+"""
+
+from __future__ import annotations
+import json
+import os
+from pathlib import Path
+from typing import Union
+
+from ..typing import VariableLike
+from .hdf5 import _dtype_lut
+
+_magic = b'SCIPPRAW'
+_version = 1
+_alignment = 64
+# Magic, version, and length of header.
+_preamble_size = len(_magic) + 4 + 8
+_not_raw_message = "This does not look like a raw file written by scipp."
+
+
+def _align(offset):
+    return -(-offset // _alignment) * _alignment
+
+
+class _Writer:
+    """
+    Collect the description of an object and the buffers to write.
+
+    Buffer offsets are relative to the start of the data section, which
+    follows the header.
+    """
+    def __init__(self):
+        self.buffers = []
+        self.size = 0
+
+    def add_buffer(self, array):
+        import numpy as np
+        array = np.ascontiguousarray(array)
+        offset = self.size
+        self.buffers.append((offset, array))
+        self.size = _align(offset + array.nbytes)
+        return {
+            'offset': offset,
+            'dtype': array.dtype.str,
+            'shape': list(array.shape)
+        }
+
+    def variable(self, var):
+        import numpy as np
+        from .._scipp.core import dtype as d
+        desc = {
+            'type': 'Variable',
+            'dims': [str(dim) for dim in var.dims],
+            'shape': list(var.shape),
+            'dtype': str(var.dtype),
+            'unit': str(var.unit)
+        }
+        if var.dtype in [d.VariableView, d.DataArrayView, d.DatasetView]:
+            from .._scipp import core as sc
+            # Avoid writing unreferenced parts of the buffer, see BinDataIO.
+            if sc.buckets.fill_ratio(var) < 1.0 / 1.5:
+                var = sc.buckets.compact(var)
+            bins = var.bins.constituents
+            desc['begin'] = self.variable(bins['begin'])
+            desc['end'] = self.variable(bins['end'])
+            desc['dim'] = bins['dim']
+            desc['data'] = self.write(bins['data'])
+        elif var.dtype == d.string:
+            encoded = [s.encode('utf-8') for s in np.ravel(var.values)]
+            lengths = [len(s) for s in encoded]
+            desc['values'] = self.add_buffer(
+                np.frombuffer(b''.join(encoded), dtype=np.uint8))
+            desc['lengths'] = self.add_buffer(np.array(lengths,
+                                                       dtype=np.int64))
+        elif var.dtype in [
+                d.float64, d.float32, d.int64, d.int32, d.bool, d.datetime64,
+                d.vector_3_float64, d.matrix_3_float64
+        ]:
+            values = var.values if var.shape else np.asarray(var.value)
+            if var.dtype == d.datetime64:
+                values = values.view(np.int64)
+            desc['values'] = self.add_buffer(values)
+            if var.variances is not None:
+                variances = var.variances if var.shape else np.asarray(
+                    var.variance)
+                desc['variances'] = self.add_buffer(variances)
+        else:
+            raise TypeError(
+                f"Writing variables with dtype={var.dtype} is not supported.")
+        return desc
+
+    def data_array(self, da):
+        if da.data is None:
+            raise RuntimeError("Cannot write object with invalid data.")
+        return {
+            'type': 'DataArray',
+            'name': da.name,
+            'data': self.variable(da.data),
+            'coords': {
+                str(name): self.variable(da.coords[name])
+                for name in da.coords
+            },
+            'masks': {name: self.variable(da.masks[name])
+                      for name in da.masks},
+            'attrs': {
+                str(name): self.variable(da.attrs[name])
+                for name in da.attrs
+            }
+        }
+
+    def dataset(self, ds):
+        # As in the HDF5 format, coords are stored for each item.
+        return {
+            'type': 'Dataset',
+            'items': {name: self.data_array(ds[name])
+                      for name in ds}
+        }
+
+    def write(self, obj):
+        name = obj.__class__.__name__.replace('View', '')
+        if name == 'Variable':
+            return self.variable(obj)
+        if name == 'DataArray':
+            return self.data_array(obj)
+        if name == 'Dataset':
+            return self.dataset(obj)
+        raise TypeError(f"Writing objects of type {name} is not supported.")
+
+
+class _Reader:
+    _dtypes = _dtype_lut()
+
+    def __init__(self, buffer):
+        self.buffer = buffer
+
+    def get_buffer(self, desc):
+        import numpy as np
+        dtype = np.dtype(desc['dtype'])
+        count = int(np.prod(desc['shape'], dtype=np.int64))
+        begin = desc['offset']
+        # Slices of the memory map reference the mapped memory, no copy.
+        return self.buffer[begin:begin + count * dtype.itemsize].view(
+            dtype).reshape(desc['shape'])
+
+    def variable(self, desc):
+        import numpy as np
+        from .._scipp import core as sc
+        from .._scipp.core import dtype as d
+        dims = desc['dims']
+        unit = sc.Unit(desc['unit'])
+        dtype = desc['dtype']
+        if dtype in [
+                str(d.VariableView),
+                str(d.DataArrayView),
+                str(d.DatasetView)
+        ]:
+            return sc.bins(begin=self.variable(desc['begin']),
+                           end=self.variable(desc['end']),
+                           dim=desc['dim'],
+                           data=self.read(desc['data']))
+        if dtype == str(d.string):
+            data = self.get_buffer(desc['values']).tobytes()
+            lengths = self.get_buffer(desc['lengths'])
+            ends = np.cumsum(lengths)
+            strings = [
+                data[end - length:end].decode('utf-8')
+                for end, length in zip(ends, lengths)
+            ]
+            values = np.array(strings, dtype=object).reshape(desc['shape'])
+            return sc.Variable(dims=dims,
+                               values=values if dims else values[()],
+                               unit=unit,
+                               dtype=d.string)
+        values = self.get_buffer(desc['values'])
+        if dtype == str(d.vector_3_float64):
+            return sc.vectors(dims=dims, values=values, unit=unit)
+        if dtype == str(d.matrix_3_float64):
+            return sc.matrices(dims=dims, values=values, unit=unit)
+        variances = self.get_buffer(
+            desc['variances']) if 'variances' in desc else None
+        # Numeric dtypes reference the mapped buffers, datetimes are copied.
+        return sc.Variable(dims=dims,
+                           values=values,
+                           variances=variances,
+                           unit=unit,
+                           dtype=self._dtypes[dtype],
+                           copy=False)
+
+    def data_array(self, desc):
+        from .._scipp import core as sc
+        return sc.DataArray(name=desc['name'],
+                            data=self.variable(desc['data']),
+                            **{
+                                category: {
+                                    name: self.variable(var)
+                                    for name, var in desc[category].items()
+                                }
+                                for category in ['coords', 'masks', 'attrs']
+                            })
+
+    def dataset(self, desc):
+        from .._scipp import core as sc
+        return sc.Dataset(data={
+            name: self.data_array(item)
+            for name, item in desc['items'].items()
+        })
+
+    def read(self, desc):
+        return getattr(self, {
+            'Variable': 'variable',
+            'DataArray': 'data_array',
+            'Dataset': 'dataset'
+        }[desc['type']])(desc)
+
+
+def _encode(obj):
+    """
+    Return the preamble and header of `obj`, the writer holding its buffers,
+    and the offset of the data section.
+    """
+    import numpy as np
+    from .._scipp import __version__
+    writer = _Writer()
+    desc = writer.write(obj)
+    header = json.dumps({
+        'scipp-version': __version__,
+        'content': desc
+    }).encode('utf-8')
+    preamble = _magic + np.uint32(_version).tobytes() + np.uint64(
+        len(header)).tobytes()
+    return preamble + header, writer, _align(_preamble_size + len(header))
+
+
+def _encode_into(obj, allocate):
+    """
+    Write `obj` into a contiguous buffer obtained from `allocate(size)`.
+
+    This is used for storage other than files, such as shared memory.
+    """
+    import numpy as np
+    header, writer, data_start = _encode(obj)
+    out = np.frombuffer(allocate(data_start + writer.size), dtype=np.uint8)
+    out[:len(header)] = np.frombuffer(header, dtype=np.uint8)
+    for offset, array in writer.buffers:
+        begin = data_start + offset
+        out[begin:begin + array.nbytes] = array.reshape(-1).view(np.uint8)
+
+
+def _decode(buffer):
+    """
+    Return the object stored in `buffer`, a 1-D NumPy array of bytes.
+
+    Variables reference `buffer` where possible and are read-only if `buffer`
+    is read-only.
+    """
+    import numpy as np
+    preamble = buffer[:_preamble_size].tobytes()
+    if len(preamble) != _preamble_size or not preamble.startswith(_magic):
+        raise RuntimeError(_not_raw_message)
+    version = int(np.frombuffer(preamble, np.uint32, 1, len(_magic))[0])
+    if version != _version:
+        raise RuntimeError(
+            f"Unsupported version {version} of raw file format.")
+    header_size = int(
+        np.frombuffer(preamble, np.uint64, 1, len(_magic) + 4)[0])
+    header = json.loads(
+        buffer[_preamble_size:_preamble_size + header_size].tobytes().decode(
+            'utf-8'))
+    data_start = _align(_preamble_size + header_size)
+    return _Reader(buffer[data_start:]).read(header['content'])
+
+
+def to_raw(obj: VariableLike, filename: Union[str, Path]):
+    """
+    Writes object to a file in the raw binary container format.
+
+    Files can be opened without copying the data using
+    :py:func:`scipp.io.open_raw`. The format is meant for exchanging data
+    between processes on the same machine and is not portable. Variables with
+    dtype of Python objects or nested scipp objects are not supported.
+
+    :param obj: Object to write.
+    :param filename: Name of the file to write.
+    """
+    import numpy as np
+    header, writer, data_start = _encode(obj)
+    # Write to a new file and replace the old one, which may be mapped by
+    # objects obtained from open_raw and must therefore not be truncated.
+    tmp = f'{filename}.tmp'
+    with open(tmp, 'wb') as f:
+        f.write(header)
+        for offset, array in writer.buffers:
+            f.seek(data_start + offset)
+            f.write(memoryview(array.reshape(-1).view(np.uint8)))
+        f.truncate(data_start + writer.size)
+    os.replace(tmp, filename)
+
+
+def open_raw(filename: Union[str, Path]) -> VariableLike:
+    """
+    Opens a file written by :py:func:`scipp.io.to_raw`.
+
+    The file is memory-mapped and variables with numeric dtype use the mapped
+    memory directly, so the cost of opening is independent of the size of the
+    data. The file is mapped copy-on-write, i.e., modifications of the
+    returned object are not written to the file. Strings, datetimes, vectors,
+    and matrices are copied.
+
+    :param filename: Name of the file to open.
+    """
+    import numpy as np
+    if os.path.getsize(filename) < _preamble_size:
+        raise RuntimeError(_not_raw_message)
+    return _decode(np.memmap(filename, dtype=np.uint8, mode='c'))
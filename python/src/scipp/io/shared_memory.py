@@ -0,0 +1,122 @@
+# SPDX-License-Identifier: BSD-3-Clause
+# Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+# @file
+# @author Simon Heybrock
+"""
+Sharing of scipp objects between processes on the same machine via POSIX
+shared memory.
+
+Objects are stored in the layout of the raw binary container format, see
+:py:mod:`scipp.io.raw`, in a named shared memory block. Other processes map
+the block read-only and use it without copy.
+"""
+
+from __future__ import annotations
+import os
+from typing import Optional
+
+from ..typing import VariableLike
+from .raw import _decode, _encode_into
+
+
+class SharedMemoryBlock:
+    """
+    Handle of a named shared memory block created by
+    :py:func:`scipp.io.to_shared_memory`.
+
+    The name remains valid until :py:meth:`unlink` is called or the creating
+    process exits. Objects opened with :py:func:`scipp.io.open_shared_memory`
+    keep the memory alive even after the name was unlinked, i.e., the memory
+    is released once the last object referencing it was destroyed.
+    """
+    def __init__(self, shm):
+        self._shm = shm
+
+    @property
+    def name(self) -> str:
+        """Name for opening the block in other processes."""
+        return self._shm.name
+
+    @property
+    def size(self) -> int:
+        """Size of the block in bytes."""
+        return self._shm.size
+
+    def unlink(self):
+        """
+        Remove the name of the block. Objects that were opened before remain
+        valid.
+        """
+        self._shm.unlink()
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *args):
+        self.unlink()
+
+
+def to_shared_memory(obj: VariableLike,
+                     name: Optional[str] = None) -> SharedMemoryBlock:
+    """
+    Copies an object into a new named block of shared memory.
+
+    :param obj: Object to share. Variables with dtype of Python objects or
+      nested scipp objects are not supported.
+    :param name: Optional, name of the block. Default=None, in which case a
+      unique name is generated.
+    :return: Handle of the block. Pass its ``name`` to other processes and
+      call ``unlink`` once no more processes need to open it.
+    """
+    from multiprocessing import shared_memory
+    shm = None
+
+    def allocate(size):
+        nonlocal shm
+        shm = shared_memory.SharedMemory(name=name, create=True, size=size)
+        return shm.buf
+
+    try:
+        _encode_into(obj, allocate)
+    except BaseException:
+        if shm is not None:
+            shm.unlink()
+        raise
+    # The creating process does not need the mapping, only the name.
+    shm.close()
+    return SharedMemoryBlock(shm)
+
+
+def open_shared_memory(name: str) -> VariableLike:
+    """
+    Opens an object shared by :py:func:`scipp.io.to_shared_memory`, typically
+    in another process.
+
+    The shared memory is mapped read-only and variables with numeric dtype use
+    it directly, i.e., opening does not copy the data and these variables are
+    read-only. This includes binned variables whose buffer uses the shared
+    memory. Strings, datetimes, vectors, and matrices are copied and are
+    writable. The mapping is kept alive by the returned object.
+
+    :param name: Name of the block, see :py:attr:`SharedMemoryBlock.name`.
+    """
+    import mmap
+    import numpy as np
+    try:
+        import _posixshmem
+    except ImportError:
+        raise RuntimeError(
+            "Shared memory is only supported on POSIX systems.") from None
+    # Using shm_open directly rather than SharedMemory avoids registering the
+    # block with the resource tracker of this process, which would otherwise
+    # unlink it when this process exits.
+    fd = _posixshmem.shm_open('/' + name, os.O_RDONLY, mode=0o600)
+    try:
+        # Copy-on-write ensures that modifications through views that do not
+        # respect the read-only flag stay local to this process.
+        buffer = mmap.mmap(fd, os.fstat(fd).st_size, access=mmap.ACCESS_COPY)
+    finally:
+        os.close(fd)
+    buffer = np.frombuffer(buffer, dtype=np.uint8)
+    buffer.flags.writeable = False
+    return _decode(buffer)
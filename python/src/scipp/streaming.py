@@ -0,0 +1,179 @@
+# SPDX-License-Identifier: BSD-3-Clause
+# Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+# @author Simon Heybrock
+"""
+Out-of-core processing of data that is provided in chunks.
+
+The functions in this module take an iterable of chunks, e.g., a generator
+reading slices of a file with :py:func:`scipp.io.open_hdf5`, and accumulate
+the result of an operation chunk by chunk. The next chunk is obtained in a
+background thread while the current chunk is processed, so only two chunks
+are held in memory at a time in addition to the result::
+
+  def chunks(filename, size, count):
+      for start in range(0, count, size):
+          selection = {'event': slice(start, start + size)}
+          yield sc.io.open_hdf5(filename, selection=selection)
+
+  hist = sc.streaming.histogram(chunks(filename, 10**7, n_event), bins=edges)
+"""
+
+from concurrent.futures import ThreadPoolExecutor
+from typing import Callable, Iterable, Optional, Sequence, TypeVar
+
+from ._scipp import core as _cpp
+from ._bins import bin as _bin, histogram as _histogram
+from ._groupby import groupby as _groupby
+from ._reduction import sum as _sum
+
+T = TypeVar('T')
+
+_end = object()
+
+
+def _next(iterator):
+    return next(iterator, _end)
+
+
+def reduce_chunks(chunks: Iterable[T],
+                  func: Callable[[T], T],
+                  combine: Optional[Callable[[T, T], T]] = None,
+                  *,
+                  prefetch: bool = True) -> T:
+    """Apply a function to each chunk and combine the results.
+
+    :param chunks: Iterable of input chunks.
+    :param func: Function applied to every chunk.
+    :param combine: Optional, function combining the accumulated result with
+      the result for the next chunk. The accumulated result may be modified
+      in-place. Default=None, in which case results are added with ``+=``.
+    :param prefetch: Optional, if True, the next chunk is obtained from
+      `chunks` in a background thread while the current chunk is processed.
+      Default=True
+    :raises: If `chunks` is empty.
+    :return: The combined result.
+    """
+    if combine is None:
+
+        def combine(a, b):
+            a += b
+            return a
+
+    iterator = iter(chunks)
+    result = None
+    with ThreadPoolExecutor(max_workers=1) as executor:
+        pending = executor.submit(_next, iterator) if prefetch else None
+        while True:
+            chunk = pending.result() if prefetch else _next(iterator)
+            if chunk is _end:
+                break
+            if prefetch:
+                pending = executor.submit(_next, iterator)
+            partial = func(chunk)
+            del chunk
+            result = partial if result is None else combine(result, partial)
+    if result is None:
+        raise ValueError("Cannot reduce an empty sequence of chunks.")
+    return result
+
+
+def histogram(chunks: Iterable[_cpp.DataArray], *, bins: _cpp.Variable,
+              prefetch: bool = True) -> _cpp.DataArray:
+    """Histogram data provided in chunks.
+
+    The result is equivalent to :py:func:`scipp.histogram` of the
+    concatenation of all chunks, up to rounding errors since floating-point
+    weights are summed in a different order.
+
+    :param chunks: Iterable of data arrays with event data.
+    :param bins: Bin edges.
+    :param prefetch: Optional, see :py:func:`reduce_chunks`.
+    :return: Histogrammed data.
+    """
+    return reduce_chunks(chunks,
+                         lambda chunk: _histogram(chunk, bins=bins),
+                         prefetch=prefetch)
+
+
+def bin(chunks: Iterable[_cpp.DataArray],
+        *,
+        edges: Optional[Sequence[_cpp.Variable]] = None,
+        groups: Optional[Sequence[_cpp.Variable]] = None,
+        erase: Optional[Sequence[_cpp.Variable]] = None,
+        prefetch: bool = True) -> _cpp.DataArray:
+    """Bin data provided in chunks.
+
+    The binned chunks are appended to the bins of the result, which is
+    equivalent to :py:func:`scipp.bin` of the concatenation of all chunks.
+    Unlike for the other functions in this module, the size of the result is
+    proportional to the size of the input. When using ``groups``, all chunks
+    must yield identical groups, i.e., the groups must be given explicitly.
+
+    Events are appended using ``scipp.buckets.append_events``, which
+    reserves spare capacity in every bin, such that the cost is proportional
+    to the number of new events. The bins of the result may therefore have
+    spare capacity, use ``scipp.buckets.compact`` to remove it.
+
+    :param chunks: Iterable of data arrays with event data.
+    :param edges: Bin edges, one per dimension to bin in.
+    :param groups: Keys to group input by one per dimension to group in.
+    :param erase: Dimension labels to remove from output.
+    :param prefetch: Optional, see :py:func:`reduce_chunks`.
+    :return: Binned data.
+    """
+    def append(a, b):
+        _cpp.buckets.append_events(a, b)
+        return a
+
+    return reduce_chunks(
+        chunks,
+        lambda chunk: _bin(chunk, edges=edges, groups=groups, erase=erase),
+        append,
+        prefetch=prefetch)
+
+
+def sum(chunks: Iterable[_cpp.DataArray],
+        dim: Optional[str] = None,
+        *,
+        prefetch: bool = True) -> _cpp.DataArray:
+    """Sum data provided in chunks.
+
+    The result is equivalent to :py:func:`scipp.sum` of the concatenation of
+    all chunks, up to rounding errors since floating-point values are summed
+    in a different order.
+
+    :param chunks: Iterable of data arrays or variables.
+    :param dim: Optional, dimension to sum over. Default=None, in which case
+      the sum over all dimensions is calculated.
+    :param prefetch: Optional, see :py:func:`reduce_chunks`.
+    :return: The sum over all chunks.
+    """
+    return reduce_chunks(chunks,
+                         lambda chunk: _sum(chunk, dim),
+                         prefetch=prefetch)
+
+
+def groupby_sum(chunks: Iterable[_cpp.DataArray],
+                group: str,
+                *,
+                bins: _cpp.Variable,
+                dim: str,
+                prefetch: bool = True) -> _cpp.DataArray:
+    """Group data provided in chunks and sum within each group.
+
+    This is equivalent to
+    ``scipp.groupby(data, group, bins=bins).sum(dim)`` for the concatenation
+    of all chunks, up to rounding errors as for :py:func:`sum`. ``bins`` is
+    required to obtain identical groups for every chunk.
+
+    :param chunks: Iterable of data arrays.
+    :param group: Name of the coord to group by.
+    :param bins: Bins for grouping the coord values.
+    :param dim: Dimension to reduce.
+    :param prefetch: Optional, see :py:func:`reduce_chunks`.
+    :return: The sum of every group.
+    """
+    return reduce_chunks(
+        chunks,
+        lambda chunk: _groupby(chunk, group, bins=bins).sum(dim),
+        prefetch=prefetch)
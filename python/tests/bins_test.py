@@ -205,3 +205,52 @@ def test_bins_sum_with_masked_buffer():
     xbins = sc.Variable(dims=['x'], unit=sc.units.m, values=[0.1, 0.5, 0.9])
     binned = sc.bin(data, edges=[xbins])
     assert binned.bins.sum().values[0] == 2
+
+
+def test_bins_append_events():
+    data = sc.Variable(dims=['x'], values=[1.0, 2.0, 3.0, 4.0])
+    begin = sc.Variable(dims=['y'], values=[0, 2], dtype=sc.dtype.int64)
+    var = sc.bins(begin=begin, dim='x', data=data)
+    events = var * 2.0
+    expected = sc.buckets.concatenate(var, events)
+    sc.buckets.append_events(var, events)
+    assert sc.identical(var, expected)
+    assert sc.identical(
+        sc.buckets.capacity(var),
+        sc.Variable(dims=['y'], values=[12, 12], dtype=sc.dtype.int64))
+    compact = sc.buckets.compact(var)
+    assert sc.identical(compact, var)
+    assert sc.identical(sc.buckets.capacity(compact), var.bins.size())
+
+
+def test_bins_compact():
+    data = sc.Variable(dims=['x'], values=[1.0, 2.0, 3.0, 4.0])
+    begin = sc.Variable(dims=['y'], values=[0, 2], dtype=sc.dtype.int64)
+    var = sc.bins(begin=begin, dim='x', data=data)
+    assert sc.buckets.is_compact(var)
+    assert sc.buckets.fill_ratio(var) == 1.0
+    assert not sc.buckets.is_compact(var['y', 1:2])
+    assert sc.buckets.fill_ratio(var['y', 1:2]) == 0.5
+    compact = sc.buckets.compact(var['y', 1:2])
+    assert sc.buckets.is_compact(compact)
+    assert sc.identical(compact, var['y', 1:2])
+
+
+def test_bins_sort():
+    table = sc.DataArray(
+        data=sc.Variable(dims=['event'], values=[1.0, 2.0, 3.0, 4.0, 5.0]),
+        coords={
+            'time': sc.Variable(dims=['event'], values=[3, 1, 2, 5, 4])
+        })
+    begin = sc.Variable(dims=['x'], values=[0, 3], dtype=sc.dtype.int64)
+    binned = sc.DataArray(data=sc.bins(begin=begin, dim='event', data=table))
+    result = binned.bins.sort('time')
+    assert sc.identical(result.bins.size(), binned.bins.size())
+    assert sc.identical(result.data.bins.constituents['data'].data,
+                        sc.Variable(dims=['event'],
+                                    values=[2.0, 3.0, 1.0, 5.0, 4.0]))
+    descending = binned.bins.sort('time', order='descending')
+    assert sc.identical(
+        descending.data.bins.constituents['data'].coords['time'],
+        sc.Variable(dims=['event'], values=[3, 2, 1, 5, 4]))
+    assert sc.identical(result.bins.sort('time'), result)
@@ -0,0 +1,145 @@
+# SPDX-License-Identifier: BSD-3-Clause
+# Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+# @file
+# @author Simon Heybrock
+import numpy as np
+import pytest
+import scipp as sc
+
+pa = pytest.importorskip('pyarrow')
+
+from scipp.compat.arrow_compat import from_arrow, to_arrow  # noqa: E402
+
+
+def _make_table():
+    x = sc.array(dims=['event'], values=np.arange(5.0), unit='m')
+    return sc.DataArray(data=sc.array(dims=['event'],
+                                      values=np.ones(5),
+                                      variances=np.ones(5),
+                                      unit='counts'),
+                        coords={'x': x},
+                        masks={'m': sc.less(x, 1.5 * sc.units.m)},
+                        name='events')
+
+
+def test_variable_roundtrip():
+    var = sc.array(dims=['row'], values=np.arange(4.0))
+    array = to_arrow(var)
+    assert array.type == pa.float64()
+    assert sc.identical(from_arrow(array), var)
+
+
+def test_variable_with_unit_raises():
+    with pytest.raises(sc.UnitError):
+        to_arrow(sc.array(dims=['row'], values=np.arange(4.0), unit='m'))
+
+
+def test_variable_export_shares_memory():
+    values = np.arange(4.0)
+    var = sc.array(dims=['row'], values=values, copy=False)
+    array = to_arrow(var)
+    assert np.shares_memory(array.to_numpy(), values)
+
+
+def test_variable_import_shares_memory_and_is_readonly():
+    array = pa.array(np.arange(4.0))
+    var = from_arrow(array, dim='x')
+    assert np.shares_memory(var.values, array.to_numpy())
+    assert not var.values.flags['WRITEABLE']
+
+
+def test_variable_with_variances():
+    var = sc.array(dims=['row'], values=[1.0, 2.0], variances=[3.0, 4.0])
+    assert sc.identical(from_arrow(to_arrow(var)), var)
+
+
+def test_variable_string():
+    var = sc.array(dims=['row'], values=['a', 'bc'])
+    assert sc.identical(from_arrow(to_arrow(var)), var)
+
+
+def test_non_1d_raises():
+    with pytest.raises(sc.DimensionError):
+        to_arrow(sc.zeros(dims=['x', 'y'], shape=[2, 2]))
+
+
+def test_data_array_roundtrip():
+    da = _make_table()
+    table = to_arrow(da)
+    assert table.column_names == ['events', 'x', 'm']
+    assert sc.identical(from_arrow(table, dim='event'), da)
+
+
+@pytest.mark.parametrize('category', ['coords', 'masks', 'attrs'])
+def test_data_array_with_0d_meta_data_raises(category):
+    da = _make_table()
+    getattr(da, category)['scalar'] = sc.scalar(True)
+    with pytest.raises(sc.DimensionError):
+        to_arrow(da)
+
+
+def test_dataset_with_0d_coord_raises():
+    ds = sc.Dataset(data={'a': sc.array(dims=['row'], values=np.arange(3))},
+                    coords={'x': sc.scalar(1.0)})
+    with pytest.raises(sc.DimensionError):
+        to_arrow(ds)
+
+
+def test_dataset_roundtrip():
+    x = sc.array(dims=['row'], values=np.arange(3.0), unit='m')
+    ds = sc.Dataset(data={
+        'a': sc.array(dims=['row'], values=np.arange(3)),
+        'b': sc.array(dims=['row'], values=np.ones(3), unit='K')
+    },
+                    coords={'x': x})
+    assert sc.identical(from_arrow(to_arrow(ds)), ds)
+
+
+def test_foreign_table_is_converted_to_dataset():
+    table = pa.table({'a': [1, 2], 'b': [1.5, 2.5]})
+    ds = from_arrow(table)
+    assert sc.identical(ds['a'].data, sc.array(dims=['row'], values=[1, 2]))
+    assert sc.identical(ds['b'].data,
+                        sc.array(dims=['row'], values=[1.5, 2.5]))
+
+
+def test_binned_roundtrip():
+    events = _make_table()
+    begin = sc.array(dims=['row'], values=[0, 2, 2], dtype=sc.dtype.int64)
+    end = sc.array(dims=['row'], values=[2, 2, 5], dtype=sc.dtype.int64)
+    binned = sc.bins(begin=begin, end=end, dim='event', data=events)
+    array = to_arrow(binned)
+    assert pa.types.is_large_list(array.type)
+    assert array.offsets.to_pylist() == [0, 2, 2, 5]
+    assert array.type.value_field.name == 'event'
+    assert sc.identical(from_arrow(array, dim='row'), binned)
+
+
+def test_binned_non_contiguous_and_slice():
+    var = sc.array(dims=['event'], values=np.arange(5.0))
+    begin = sc.array(dims=['row'], values=[3, 0], dtype=sc.dtype.int64)
+    end = sc.array(dims=['row'], values=[5, 1], dtype=sc.dtype.int64)
+    binned = sc.bins(begin=begin, end=end, dim='event', data=var)
+    assert sc.identical(from_arrow(to_arrow(binned)), binned)
+    assert sc.identical(from_arrow(to_arrow(binned['row', 1:])),
+                        binned['row', 1:])
+
+
+def test_binned_variable_unit_roundtrip():
+    var = sc.array(dims=['event'], values=np.arange(4.0), unit='m')
+    begin = sc.array(dims=['row'], values=[0, 2], dtype=sc.dtype.int64)
+    binned = sc.bins(begin=begin, dim='event', data=var)
+    with pytest.raises(sc.UnitError):
+        to_arrow(binned)
+    da = sc.DataArray(data=binned, name='a')
+    assert sc.identical(from_arrow(to_arrow(da), dim='row'), da)
+
+
+def test_binned_import_is_readonly():
+    events = sc.array(dims=['event'], values=np.arange(4.0))
+    begin = sc.array(dims=['row'], values=[0, 2], dtype=sc.dtype.int64)
+    binned = sc.bins(begin=begin, dim='event', data=events)
+    result = from_arrow(to_arrow(binned))
+    assert sc.identical(result, binned)
+    with pytest.raises(sc.VariableError):
+        result['row', 0] = result['row', 1]
@@ -0,0 +1,43 @@
+# SPDX-License-Identifier: BSD-3-Clause
+# Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+# @file
+# @author Simon Heybrock
+import numpy as np
+import pytest
+import scipp as sc
+from scipp.compat.dlpack_compat import from_dlpack
+
+pytestmark = pytest.mark.skipif(not hasattr(np, 'from_dlpack'),
+                                reason='DLPack requires NumPy 1.22')
+
+
+def test_export_shares_memory():
+    var = sc.array(dims=['x', 'y'], values=np.arange(6.0).reshape(2, 3))
+    array = np.from_dlpack(var)
+    np.testing.assert_array_equal(array, var.values)
+    var['x', 1]['y', 2].value = -1.0
+    assert array[1, 2] == -1.0
+
+
+def test_export_slice():
+    var = sc.array(dims=['x', 'y'], values=np.arange(6.0).reshape(2, 3))
+    np.testing.assert_array_equal(np.from_dlpack(var['y', 1:]),
+                                  var.values[:, 1:])
+
+
+def test_export_with_variances_raises():
+    var = sc.array(dims=['x'], values=[1.0], variances=[1.0])
+    with pytest.raises(sc.VariancesError):
+        np.from_dlpack(var)
+
+
+def test_import_shares_memory():
+    values = np.arange(4.0)
+    var = from_dlpack(values, dims=['x'], unit='m')
+    assert var.unit == sc.units.m
+    assert np.shares_memory(var.values, values)
+
+
+def test_roundtrip():
+    var = sc.array(dims=['x'], values=np.arange(4, dtype=np.int32))
+    assert sc.identical(from_dlpack(var, dims=['x']), var)
@@ -186,3 +186,162 @@ def test_data_array_unsupported_PyObject_coord():
 def test_dataset():
     d = sc.Dataset(data={'a': array_1d, 'b': array_2d})
     check_roundtrip(d)
+
+
+def roundtrip_selection(obj, selection, **kwargs):
+    with tempfile.TemporaryDirectory() as path:
+        name = f'{path}/test.hdf5'
+        obj.to_hdf5(filename=name, **kwargs)
+        return sc.io.open_hdf5(filename=name, selection=selection)
+
+
+def test_compression():
+    import h5py
+    with tempfile.TemporaryDirectory() as path:
+        name = f'{path}/test.hdf5'
+        array_2d.to_hdf5(filename=name, compression='gzip', compression_opts=4)
+        with h5py.File(name, 'r') as f:
+            assert f['data']['values'].compression == 'gzip'
+            assert f['data']['values'].chunks is not None
+        assert sc.identical(sc.io.open_hdf5(filename=name), array_2d)
+
+
+def test_compression_scalar_and_string():
+    a = sc.DataArray(data=sc.Variable(dims=['x'], values=['abc', 'def']),
+                     attrs={'attr': 1.2 * sc.units.K})
+    with tempfile.TemporaryDirectory() as path:
+        name = f'{path}/test.hdf5'
+        a.to_hdf5(filename=name, compression='lzf')
+        assert sc.identical(sc.io.open_hdf5(filename=name), a)
+
+
+def test_variable_selection():
+    assert sc.identical(roundtrip_selection(xy, {'x': slice(1, 3)}),
+                        xy['x', 1:3])
+    assert sc.identical(roundtrip_selection(xy, {'y': 2}), xy['y', 2])
+    assert sc.identical(roundtrip_selection(xy, {'z': 2}), xy)
+
+
+def test_variable_eigen_selection():
+    assert sc.identical(roundtrip_selection(eigen_1d, {'x': slice(1, 3)}),
+                        eigen_1d['x', 1:3])
+
+
+def test_data_array_selection():
+    for selection in [{
+            'x': slice(1, 3)
+    }, {
+            'y': slice(2, None),
+            'x': -1
+    }]:
+        expected = array_2d
+        for dim, index in selection.items():
+            expected = expected[dim, index]
+        result = roundtrip_selection(array_2d, selection, chunks=True)
+        assert sc.identical(result, expected)
+
+
+def test_data_array_selection_bin_edges():
+    edges = sc.Variable(dims=['x'], values=np.arange(5.0), unit=sc.units.m)
+    a = sc.DataArray(data=x, coords={'x': edges})
+    assert sc.identical(roundtrip_selection(a, {'x': slice(1, 3)}),
+                        a['x', 1:3])
+    assert sc.identical(roundtrip_selection(a, {'x': 2}), a['x', 2])
+
+
+def test_dataset_selection():
+    d = sc.Dataset(data={'a': array_1d, 'b': array_2d})
+    assert sc.identical(roundtrip_selection(d, {'x': slice(0, 2)}),
+                        d['x', 0:2])
+
+
+def test_variable_binned_selection():
+    begin = sc.Variable(dims=['y'], values=[0, 3, 3], dtype=sc.dtype.int64)
+    end = sc.Variable(dims=['y'], values=[3, 3, 4], dtype=sc.dtype.int64)
+    binned = sc.bins(begin=begin, end=end, dim='x', data=x)
+    result = roundtrip_selection(binned, {'y': slice(2, 3)})
+    assert sc.identical(result, binned['y', 2:3])
+    assert result.bins.constituents['data'].shape[0] == 1
+    result = roundtrip_selection(binned, {'y': 1})
+    assert sc.identical(result, binned['y', 1])
+    assert result.bins.constituents['data'].shape[0] == 0
+
+
+def open_lazy(obj, path):
+    name = f'{path}/test.hdf5'
+    obj.to_hdf5(filename=name)
+    return sc.io.open_hdf5(filename=name, lazy=True)
+
+
+def test_lazy_variable(tmp_path):
+    lazy = open_lazy(xy, tmp_path)
+    assert lazy.dims == xy.dims
+    assert lazy.shape == xy.shape
+    assert lazy.unit == xy.unit
+    assert lazy.dtype == xy.dtype
+    assert sc.identical(lazy.load(), xy)
+    sliced = lazy['x', 1:3]['y', 2]
+    assert sliced.dims == ['x']
+    assert sliced.shape == [2]
+    assert sc.identical(sliced.load(), xy['x', 1:3]['y', 2])
+    assert sc.identical(lazy['x', 1:3]['x', 1].load(), xy['x', 2])
+    np.testing.assert_array_equal(sliced.values, xy['x', 1:3]['y', 2].values)
+
+
+def test_lazy_data_array(tmp_path):
+    lazy = open_lazy(array_2d, tmp_path)
+    assert lazy.sizes == {'y': 6, 'x': 4}
+    assert set(lazy.coords) == {'x', 'y', 'x2'}
+    assert lazy.coords['x'].unit == sc.units.m
+    assert sc.identical(lazy.load(), array_2d)
+    for key in [('x', slice(1, 3)), ('y', 2), ('x', -1)]:
+        assert sc.identical(lazy[key].load(), array_2d[key])
+    assert sc.identical(lazy['x', 1:3].coords['x'].load(),
+                        array_2d['x', 1:3].coords['x'])
+
+
+def test_lazy_data_array_bin_edges(tmp_path):
+    edges = sc.Variable(dims=['x'], values=np.arange(5.0), unit=sc.units.m)
+    a = sc.DataArray(data=x, coords={'x': edges})
+    lazy = open_lazy(a, tmp_path)
+    assert lazy.coords['x'].shape == [5]
+    assert lazy['x', 1:3].coords['x'].shape == [3]
+    assert sc.identical(lazy['x', 1:3].load(), a['x', 1:3])
+    assert sc.identical(lazy['x', 1:3].coords['x'].load(),
+                        a['x', 1:3].coords['x'])
+
+
+def test_lazy_data_array_label_based_slicing(tmp_path):
+    lazy = open_lazy(array_2d, tmp_path)
+    assert sc.identical(lazy['x', 1.0 * sc.units.m].load(),
+                        array_2d['x', 1.0 * sc.units.m])
+    key = slice(1.0 * sc.units.m, 3.0 * sc.units.m)
+    assert sc.identical(lazy['x', key].load(), array_2d['x', key])
+
+
+def test_lazy_binned(tmp_path):
+    begin = sc.Variable(dims=['y'], values=[0, 3, 3], dtype=sc.dtype.int64)
+    end = sc.Variable(dims=['y'], values=[3, 3, 4], dtype=sc.dtype.int64)
+    binned = sc.bins(begin=begin, end=end, dim='x', data=x)
+    lazy = open_lazy(binned, tmp_path)
+    assert lazy.dtype == binned.dtype
+    assert sc.identical(lazy['y', 2:].load(), binned['y', 2:])
+
+
+def test_lazy_dataset(tmp_path):
+    d = sc.Dataset(data={'a': array_1d, 'b': array_2d})
+    lazy = open_lazy(d, tmp_path)
+    assert set(lazy.keys()) == {'a', 'b'}
+    assert lazy['b'].sizes == {'y': 6, 'x': 4}
+    assert sc.identical(lazy.load(), d)
+    assert sc.identical(lazy['x', 1:3].load(), d['x', 1:3])
+
+
+def test_lazy_selection(tmp_path):
+    name = f'{tmp_path}/test.hdf5'
+    array_2d.to_hdf5(filename=name)
+    lazy = sc.io.open_hdf5(filename=name,
+                           selection={'x': slice(1, 3)},
+                           lazy=True)
+    assert lazy.sizes == {'y': 6, 'x': 2}
+    assert sc.identical(lazy.load(), array_2d['x', 1:3])
@@ -0,0 +1,119 @@
+# SPDX-License-Identifier: BSD-3-Clause
+# Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+# @file
+# @author Simon Heybrock
+import itertools
+import scipp as sc
+import numpy as np
+import pytest
+
+_file_index = itertools.count()
+
+
+def roundtrip(obj, path):
+    # Files stay mapped as long as the result is alive, so they are removed
+    # only after the test by pytest.
+    name = path / f'{next(_file_index)}.raw'
+    sc.io.to_raw(obj, filename=name)
+    return sc.io.open_raw(filename=name)
+
+
+def check_roundtrip(obj, path):
+    result = roundtrip(obj, path)
+    assert sc.identical(result, obj)
+    return result
+
+
+x = sc.Variable(dims=['x'], values=np.arange(4.0), unit=sc.units.m)
+y = sc.Variable(dims=['y'], values=np.arange(6.0), unit=sc.units.angstrom)
+xy = sc.Variable(dims=['y', 'x'],
+                 values=np.random.rand(6, 4),
+                 variances=np.random.rand(6, 4),
+                 unit=sc.units.kg)
+array_2d = sc.DataArray(data=xy,
+                        coords={
+                            'x': x,
+                            'y': y,
+                            'x2': 2.0 * x
+                        },
+                        masks={'mask': sc.less(x, 1.5 * sc.units.m)},
+                        attrs={'attr': 1.2 * sc.units.K})
+
+
+@pytest.mark.parametrize("dtype", [
+    sc.dtype.float64, sc.dtype.float32, sc.dtype.int64, sc.dtype.int32,
+    sc.dtype.bool
+])
+def test_variable_dtypes(dtype, tmp_path):
+    check_roundtrip(sc.Variable(dims=['x'], values=[1, 0, 1], dtype=dtype),
+                    tmp_path)
+    check_roundtrip(sc.scalar(1, dtype=dtype), tmp_path)
+
+
+def test_variable_2d(tmp_path):
+    check_roundtrip(xy, tmp_path)
+    check_roundtrip(xy['x', 1:3], tmp_path)
+    check_roundtrip(sc.transpose(xy, dims=['x', 'y']), tmp_path)
+    check_roundtrip(xy['x', 1:1], tmp_path)
+
+
+def test_variable_datetime64(tmp_path):
+    check_roundtrip(
+        sc.Variable(dims=['x'],
+                    dtype=sc.dtype.datetime64,
+                    unit='ms',
+                    values=np.arange(10)), tmp_path)
+
+
+def test_variable_eigen(tmp_path):
+    check_roundtrip(sc.vectors(dims=['x'], values=np.random.rand(4, 3)),
+                    tmp_path)
+    check_roundtrip(sc.matrices(dims=['x'], values=np.random.rand(4, 3, 3)),
+                    tmp_path)
+    check_roundtrip(sc.vector(value=[1.0, 2.0, 3.0]), tmp_path)
+
+
+def test_variable_string(tmp_path):
+    check_roundtrip(sc.Variable(dims=['x'], values=['abc', '', 'äöü']),
+                    tmp_path)
+    check_roundtrip(sc.scalar('abc'), tmp_path)
+
+
+def test_variable_binned(tmp_path):
+    begin = sc.Variable(dims=['y'], values=[0, 3], dtype=sc.dtype.int64)
+    end = sc.Variable(dims=['y'], values=[3, 4], dtype=sc.dtype.int64)
+    check_roundtrip(sc.bins(begin=begin, end=end, dim='x', data=x), tmp_path)
+    table = sc.DataArray(data=x, coords={'x': x})
+    check_roundtrip(sc.bins(begin=begin, end=end, dim='x', data=table),
+                    tmp_path)
+
+
+def test_data_array(tmp_path):
+    check_roundtrip(array_2d, tmp_path)
+
+
+def test_dataset(tmp_path):
+    check_roundtrip(sc.Dataset(data={'a': array_2d, 'b': array_2d * 2.0}),
+                    tmp_path)
+
+
+def test_unsupported_dtype_raises(tmp_path):
+    with pytest.raises(TypeError):
+        roundtrip(sc.scalar(dict()), tmp_path)
+
+
+def test_not_a_raw_file_raises(tmp_path):
+    name = tmp_path / 'test.raw'
+    with open(name, 'wb') as f:
+        f.write(b'not scipp')
+    with pytest.raises(RuntimeError):
+        sc.io.open_raw(filename=name)
+
+
+def test_modifying_result_does_not_modify_file(tmp_path):
+    name = tmp_path / 'test.raw'
+    sc.io.to_raw(array_2d, filename=name)
+    a = sc.io.open_raw(filename=name)
+    a.values[0, 0] = -1.0
+    assert a.values[0, 0] == -1.0
+    assert sc.identical(sc.io.open_raw(filename=name), array_2d)
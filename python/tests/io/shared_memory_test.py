@@ -0,0 +1,78 @@
+# SPDX-License-Identifier: BSD-3-Clause
+# Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+# @file
+# @author Simon Heybrock
+from concurrent.futures import ProcessPoolExecutor
+import os
+
+import numpy as np
+import pytest
+
+import scipp as sc
+
+pytestmark = pytest.mark.skipif(os.name != 'posix',
+                                reason='requires POSIX shared memory')
+
+
+def make_data_array():
+    x = sc.array(dims=['x'], values=np.arange(4.0), unit='m')
+    events = sc.DataArray(data=sc.ones(dims=['event'], shape=[5]),
+                          coords={'t': sc.arange('event', 5.0, unit='s')})
+    begin = sc.array(dims=['x'], values=[0, 2, 2, 4], dtype=sc.dtype.int64)
+    end = sc.array(dims=['x'], values=[2, 2, 4, 5], dtype=sc.dtype.int64)
+    return sc.DataArray(data=sc.bins(begin=begin,
+                                     end=end,
+                                     dim='event',
+                                     data=events),
+                        coords={
+                            'x': x,
+                            'label': sc.array(dims=['x'],
+                                              values=['a', 'b', 'c', 'd'])
+                        })
+
+
+def sum_in_worker(name):
+    return sc.io.open_shared_memory(name).bins.sum().data.values.tolist()
+
+
+def test_roundtrip_is_readonly():
+    da = make_data_array()
+    with sc.io.to_shared_memory(da) as block:
+        result = sc.io.open_shared_memory(block.name)
+    assert sc.identical(result, da)
+    assert not result.coords['x'].values.flags['WRITEABLE']
+    with pytest.raises(sc.VariableError):
+        result.coords['x']['x', 0] = 1.0 * sc.units.m
+    with pytest.raises(sc.VariableError):
+        result.data['x', 0] = result.data['x', 1]
+
+
+def test_named_block():
+    var = sc.array(dims=['x'], values=np.arange(10.0))
+    name = f'scipp-test-{os.getpid()}'
+    with sc.io.to_shared_memory(var, name=name) as block:
+        assert block.name == name
+        assert sc.identical(sc.io.open_shared_memory(name), var)
+
+
+def test_open_after_unlink_raises():
+    block = sc.io.to_shared_memory(sc.scalar(1.0))
+    block.unlink()
+    with pytest.raises(FileNotFoundError):
+        sc.io.open_shared_memory(block.name)
+
+
+def test_object_outlives_unlink():
+    var = sc.array(dims=['x'], values=np.arange(1000.0))
+    block = sc.io.to_shared_memory(var)
+    result = sc.io.open_shared_memory(block.name)
+    block.unlink()
+    assert sc.identical(result, var)
+
+
+def test_open_in_other_process():
+    da = make_data_array()
+    with sc.io.to_shared_memory(da) as block:
+        with ProcessPoolExecutor(max_workers=1) as executor:
+            result = executor.submit(sum_in_worker, block.name).result()
+    assert result == da.bins.sum().data.values.tolist()
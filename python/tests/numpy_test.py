@@ -70,6 +70,32 @@ def test_numpy_self_assign_shift_2d_flip_second():
     assert sc.identical(var, expected)
 
 
+@pytest.mark.parametrize('ndim', [0, 1, 2, 5, 6])
+def test_numpy_ingest_ndim(ndim):
+    shape = (2, 3, 1, 2, 2, 3)[:ndim]
+    values = np.arange(np.prod(shape, dtype=int), dtype=float).reshape(shape)
+    dims = ['a', 'b', 'c', 'd', 'e', 'f'][:ndim]
+    var = sc.Variable(dims=dims, values=values)
+    np.testing.assert_array_equal(var.values, values)
+
+
+def test_numpy_ingest_non_contiguous():
+    base = np.arange(2 * 3 * 4 * 5 * 6).reshape(2, 3, 4, 5, 6)
+    values = base.transpose(4, 0, 3, 1, 2)[::-2, :, 1::2]
+    var = sc.Variable(dims=['a', 'b', 'c', 'd', 'e'], values=values)
+    np.testing.assert_array_equal(var.values, values)
+
+
+def test_numpy_assign_5d_into_slice():
+    var = sc.Variable(dims=['a', 'b', 'c', 'd', 'e'],
+                      values=np.zeros((2, 3, 2, 2, 4)))
+    values = np.arange(2 * 3 * 2 * 2 * 2.0).reshape(2, 3, 2, 2, 2)
+    var['e', 1:3].values = values
+    np.testing.assert_array_equal(var['e', 1:3].values, values)
+    assert np.all(var['e', 0].values == 0)
+    assert np.all(var['e', 3].values == 0)
+
+
 a = np.arange(2)
 var = sc.Variable(dims=['x'], values=a)
 arr = sc.DataArray(var)
@@ -0,0 +1,78 @@
+# SPDX-License-Identifier: BSD-3-Clause
+# Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+# @file
+# @author Simon Heybrock
+import pickle
+
+import numpy as np
+import pytest
+
+import scipp as sc
+
+
+def make_data_array():
+    x = sc.array(dims=['x'], values=np.arange(4.0), unit='m')
+    return sc.DataArray(data=sc.array(dims=['y', 'x'],
+                                      values=np.random.rand(3, 4),
+                                      variances=np.random.rand(3, 4),
+                                      unit='counts'),
+                        coords={
+                            'x': x,
+                            'label': sc.array(dims=['y'],
+                                              values=['a', 'b', 'c'])
+                        },
+                        masks={'m': sc.less(x, 1.5 * sc.units.m)},
+                        attrs={'scalar': 1.2 * sc.units.K})
+
+
+def make_binned():
+    events = sc.DataArray(data=sc.ones(dims=['event'], shape=[5]),
+                          coords={'t': sc.arange('event', 5.0, unit='s')})
+    begin = sc.array(dims=['x'], values=[0, 2, 2], dtype=sc.dtype.int64)
+    end = sc.array(dims=['x'], values=[2, 2, 5], dtype=sc.dtype.int64)
+    return sc.bins(begin=begin, end=end, dim='event', data=events)
+
+
+@pytest.mark.parametrize('protocol', range(2, pickle.HIGHEST_PROTOCOL + 1))
+@pytest.mark.parametrize(
+    'obj', [make_data_array(),
+            make_data_array().data,
+            make_binned()])
+def test_roundtrip(obj, protocol):
+    assert sc.identical(pickle.loads(pickle.dumps(obj, protocol=protocol)),
+                        obj)
+
+
+def test_roundtrip_dataset():
+    ds = sc.Dataset(data={'a': make_data_array()})
+    assert sc.identical(pickle.loads(pickle.dumps(ds)), ds)
+
+
+def test_roundtrip_slice():
+    da = make_data_array()['x', 1:3]
+    assert sc.identical(pickle.loads(pickle.dumps(da)), da)
+
+
+@pytest.mark.skipif(pickle.HIGHEST_PROTOCOL < 5,
+                    reason='requires pickle protocol 5')
+def test_protocol_5_out_of_band_buffers_are_not_copied():
+    var = sc.array(dims=['x'], values=np.arange(1000.0))
+    buffers = []
+    data = pickle.dumps(var, protocol=5, buffer_callback=buffers.append)
+    assert len(data) < 1000
+    assert len(buffers) == 1
+    result = pickle.loads(data, buffers=buffers)
+    assert sc.identical(result, var)
+    var.values[0] = -1.0
+    assert result.values[0] == -1.0
+
+
+def test_unpickled_object_is_writable():
+    var = pickle.loads(pickle.dumps(sc.array(dims=['x'], values=[1.0, 2.0])))
+    var.values[0] = 3.0
+    assert var.values[0] == 3.0
+
+
+def test_pickle_unsupported_dtype_raises():
+    with pytest.raises(TypeError):
+        pickle.dumps(sc.scalar(dict()))
@@ -0,0 +1,154 @@
+# SPDX-License-Identifier: BSD-3-Clause
+# Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+# @author Simon Heybrock
+import threading
+
+import numpy as np
+import pytest
+
+import scipp as sc
+
+
+def make_events(size=1000):
+    rng = np.random.default_rng(seed=1234)
+    return sc.DataArray(data=sc.ones(dims=['event'], shape=[size]),
+                        coords={
+                            'x':
+                            sc.array(dims=['event'],
+                                     values=rng.random(size),
+                                     unit='m'),
+                            'label':
+                            sc.array(dims=['event'],
+                                     values=rng.integers(0, 4, size),
+                                     dtype=sc.dtype.int64)
+                        })
+
+
+def chunks(data, size):
+    for start in range(0, data.shape[0], size):
+        yield data['event', start:start + size].copy()
+
+
+edges = sc.linspace('x', 0.0, 1.0, num=11, unit='m')
+
+
+@pytest.mark.parametrize('prefetch', [True, False])
+def test_histogram(prefetch):
+    events = make_events()
+    result = sc.streaming.histogram(chunks(events, 128),
+                                    bins=edges,
+                                    prefetch=prefetch)
+    assert sc.identical(result, sc.histogram(events, bins=edges))
+
+
+def make_weighted_events(size=1000):
+    events = make_events(size)
+    rng = np.random.default_rng(seed=4321)
+    events.data = sc.array(dims=['event'],
+                           values=rng.random(size),
+                           variances=rng.random(size),
+                           unit='counts')
+    return events
+
+
+def assert_allclose(result, expected):
+    # Floating-point weights are summed in a different order than for a
+    # single chunk, so results are not bitwise identical.
+    assert set(result.coords.keys()) == set(expected.coords.keys())
+    for key in expected.coords:
+        assert sc.identical(result.coords[key], expected.coords[key])
+    assert result.unit == expected.unit
+    assert np.allclose(result.values, expected.values, rtol=1e-12)
+    assert np.allclose(result.variances, expected.variances, rtol=1e-12)
+
+
+def test_histogram_float_weights():
+    events = make_weighted_events()
+    result = sc.streaming.histogram(chunks(events, 128), bins=edges)
+    assert_allclose(result, sc.histogram(events, bins=edges))
+
+
+def test_sum_float_weights():
+    events = make_weighted_events()
+    result = sc.streaming.sum(chunks(events, 64), 'event')
+    assert_allclose(result, sc.sum(events, 'event'))
+
+
+def test_groupby_sum_float_weights():
+    events = make_weighted_events()
+    result = sc.streaming.groupby_sum(chunks(events, 250),
+                                      'x',
+                                      bins=edges,
+                                      dim='event')
+    assert_allclose(result,
+                    sc.groupby(events, 'x', bins=edges).sum('event'))
+
+
+def test_bin():
+    events = make_events()
+    result = sc.streaming.bin(chunks(events, 100), edges=[edges])
+    assert sc.identical(result, sc.bin(events, edges=[edges]))
+
+
+def test_bin_float_weights():
+    events = make_weighted_events()
+    result = sc.streaming.bin(chunks(events, 100), edges=[edges])
+    assert sc.identical(result, sc.bin(events, edges=[edges]))
+
+
+def test_bin_many_chunks_into_few_bins():
+    events = make_events(size=2000)
+    result = sc.streaming.bin(chunks(events, 7), edges=[edges])
+    assert sc.identical(result, sc.bin(events, edges=[edges]))
+
+
+def test_bin_groups():
+    events = make_events()
+    groups = sc.array(dims=['label'], values=[0, 1, 2, 3])
+    result = sc.streaming.bin(chunks(events, 300),
+                              edges=[edges],
+                              groups=[groups])
+    assert sc.identical(result, sc.bin(events, edges=[edges],
+                                       groups=[groups]))
+
+
+def test_sum():
+    events = make_events()
+    result = sc.streaming.sum(chunks(events, 64), 'event')
+    assert sc.identical(result, sc.sum(events, 'event'))
+
+
+def test_groupby_sum():
+    events = make_events()
+    result = sc.streaming.groupby_sum(chunks(events, 250),
+                                      'x',
+                                      bins=edges,
+                                      dim='event')
+    assert sc.identical(result,
+                        sc.groupby(events, 'x', bins=edges).sum('event'))
+
+
+def test_empty_raises():
+    with pytest.raises(ValueError):
+        sc.streaming.histogram([], bins=edges)
+
+
+def test_reduce_chunks_prefetches_in_other_thread():
+    threads = set()
+
+    def generate():
+        for i in range(3):
+            threads.add(threading.get_ident())
+            yield i
+
+    assert sc.streaming.reduce_chunks(generate(), lambda x: x) == 3
+    assert threading.get_ident() not in threads
+    assert sc.streaming.reduce_chunks(generate(),
+                                      lambda x: x,
+                                      prefetch=False) == 3
+    assert threading.get_ident() in threads
+
+
+def test_reduce_chunks_custom_combine():
+    assert sc.streaming.reduce_chunks([1, 2, 3], lambda x: [x],
+                                      lambda a, b: a + b) == [1, 2, 3]
@@ -311,6 +311,15 @@ def test_arange():
     assert sc.identical(var, expected)
 
 
+@pytest.mark.parametrize("args", [(21, ), (10, 21, 2), (5, -3, -2), (5, 0),
+                                  (0.0, 1.0, 0.1), (1, 2.5, 0.25)])
+def test_arange_matches_numpy(args):
+    var = sc.arange('x', *args, unit='m')
+    expected = sc.Variable(dims=['x'], values=np.arange(*args), unit='m')
+    assert sc.identical(var, expected)
+    assert np.array_equal(var.values, np.arange(*args))
+
+
 def test_zeros_sizes():
     dims = ['x', 'y', 'z']
     shape = [2, 3, 4]
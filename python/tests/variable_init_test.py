@@ -385,3 +385,73 @@ def test_create_2d_values_and_variances_array_like(inner_values_type,
                       variances=outer_variances_type(
                           [inner_variances_type(val) for val in variances]))
     assert sc.identical(var, expected)
+
+
+@pytest.mark.parametrize('dtype', (np.float64, np.float32, np.int64, np.int32))
+def test_create_with_copy_false_shares_buffer(dtype):
+    values = np.arange(6, dtype=dtype).reshape(2, 3)
+    var = sc.Variable(dims=['x', 'y'], values=values, copy=False)
+    values[1, 2] = 9
+    assert var.values[1, 2] == 9
+    var['x', 0]['y', 1].value = 2
+    assert values[0, 1] == 2
+
+
+def test_create_with_copy_false_shares_variances():
+    values = np.arange(4.0)
+    variances = np.arange(4.0) + 1
+    var = sc.Variable(dims=['x'],
+                      values=values,
+                      variances=variances,
+                      copy=False)
+    variances[0] = 10.0
+    assert var.variances[0] == 10.0
+
+
+def test_create_with_copy_false_strided():
+    base = np.arange(24.0).reshape(4, 6)
+    values = base[::2, 1::3]
+    var = sc.Variable(dims=['x', 'y'], values=values, copy=False)
+    np.testing.assert_array_equal(var.values, values)
+    base[2, 4] = -1.0
+    assert var.values[1, 1] == -1.0
+    assert sc.identical(var, sc.Variable(dims=['x', 'y'], values=values))
+
+
+def test_create_with_copy_false_keeps_array_alive():
+    var = sc.Variable(dims=['x'], values=np.arange(3.0) + 1, copy=False)
+    np.testing.assert_array_equal(var.values, [1.0, 2.0, 3.0])
+
+
+@pytest.mark.parametrize('values', (
+    np.arange(4.0)[::-1],
+    np.arange(4.0, dtype='>f8'),
+))
+def test_create_with_copy_false_falls_back_to_copy(values):
+    var = sc.Variable(dims=['x'], values=values, copy=False)
+    np.testing.assert_array_equal(var.values, values)
+    assert not np.shares_memory(var.values, values)
+
+
+def test_create_with_copy_false_readonly():
+    values = np.arange(4.0)
+    values.flags.writeable = False
+    var = sc.Variable(dims=['x'], values=values, copy=False)
+    assert np.shares_memory(var.values, values)
+    assert not var.values.flags['WRITEABLE']
+    with pytest.raises(sc.VariableError):
+        var['x', 1] = var['x', 0]
+
+
+def test_create_with_copy_false_converts_datetime():
+    values = np.array([1, 2], dtype='datetime64[s]')
+    var = sc.Variable(dims=['x'], values=values, copy=False)
+    assert var.unit == sc.units.s
+    np.testing.assert_array_equal(var.values, values)
+
+
+def test_array_copy_false():
+    values = np.arange(3.0)
+    var = sc.array(dims=['x'], values=values, copy=False)
+    values[0] = 5.0
+    assert var.values[0] == 5.0
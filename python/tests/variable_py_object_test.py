@@ -2,6 +2,8 @@
 # Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
 # @file
 # @author Simon Heybrock
+from concurrent.futures import ThreadPoolExecutor
+
 import scipp as sc
 
 
@@ -62,3 +64,18 @@ def test_py_object_delitem():
     # Dataset.__delitem__ releases the GIL. This will segfault unless
     # scipp::python::PyObject::~PyObject acquires the GIL.
     del d['a']
+
+
+def test_py_object_operations_in_threads():
+    # Bindings release the GIL, elements must acquire it when copied.
+    var = sc.concatenate(sc.scalar({'a': [1, 2]}), sc.scalar({'b': 3}), 'x')
+    expected = sc.concatenate(var, var, 'x')
+
+    def work(_):
+        out = sc.concatenate(var, var, 'x')
+        out['x', 0] = var['x', 1]
+        out['x', 0] = var['x', 0]
+        return sc.identical(out, expected)
+
+    with ThreadPoolExecutor(max_workers=4) as executor:
+        assert all(executor.map(work, range(32)))
@@ -905,3 +905,21 @@ def test_sort():
     var = sc.Variable(dims=(), values=0.0)
     assert_export(sc.sort, x=var, dim='x', order='ascending')
     assert_export(sc.issorted, x=var, dim='x', order='ascending')
+
+
+def test_argsort_take():
+    var = sc.Variable(dims=['x'], values=[3.0, 1.0, 2.0, 1.0])
+    indices = sc.argsort(var)
+    assert sc.identical(indices, sc.Variable(dims=['x'], values=[1, 3, 2, 0]))
+    assert sc.identical(sc.take(var, indices, 'x'), sc.sort(var, var))
+    assert sc.identical(sc.argsort(var, order='descending'),
+                        sc.Variable(dims=['x'], values=[0, 2, 1, 3]))
+
+
+def test_put():
+    var = sc.Variable(dims=['x'], values=[3.0, 1.0, 2.0, 1.0])
+    indices = sc.Variable(dims=['x'], values=[2, 0])
+    out = sc.zeros_like(var)
+    sc.put(out, indices, sc.take(var, indices, 'x'), 'x')
+    assert sc.identical(out,
+                        sc.Variable(dims=['x'], values=[3.0, 0.0, 2.0, 0.0]))
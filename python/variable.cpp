@@ -91,38 +91,43 @@ of variances.)");
       .def_property_readonly("dtype", &Variable::dtype)
       .def(
           "__radd__", [](Variable &a, double &b) { return a + b * units::one; },
-          py::is_operator())
+          py::is_operator(), py::call_guard<py::gil_scoped_release>())
       .def(
           "__radd__", [](Variable &a, int &b) { return a + b * units::one; },
-          py::is_operator())
+          py::is_operator(), py::call_guard<py::gil_scoped_release>())
       .def(
           "__rsub__", [](Variable &a, double &b) { return b * units::one - a; },
-          py::is_operator())
+          py::is_operator(), py::call_guard<py::gil_scoped_release>())
       .def(
           "__rsub__", [](Variable &a, int &b) { return b * units::one - a; },
-          py::is_operator())
+          py::is_operator(), py::call_guard<py::gil_scoped_release>())
       .def(
           "__rmul__",
           [](Variable &a, double &b) { return a * (b * units::one); },
-          py::is_operator())
+          py::is_operator(), py::call_guard<py::gil_scoped_release>())
       .def(
           "__rmul__", [](Variable &a, int &b) { return a * (b * units::one); },
-          py::is_operator())
+          py::is_operator(), py::call_guard<py::gil_scoped_release>())
       .def(
           "__rtruediv__",
           [](Variable &a, double &b) { return (b * units::one) / a; },
-          py::is_operator())
+          py::is_operator(), py::call_guard<py::gil_scoped_release>())
       .def(
           "__rtruediv__",
           [](Variable &a, int &b) { return (b * units::one) / a; },
-          py::is_operator())
-      .def("__sizeof__",
-           [](const Variable &self) {
-             return size_of(self, SizeofTag::ViewOnly);
-           })
-      .def("underlying_size", [](const Variable &self) {
-        return size_of(self, SizeofTag::Underlying);
-      });
+          py::is_operator(), py::call_guard<py::gil_scoped_release>())
+      .def(
+          "__sizeof__",
+          [](const Variable &self) {
+            return size_of(self, SizeofTag::ViewOnly);
+          },
+          py::call_guard<py::gil_scoped_release>())
+      .def(
+          "underlying_size",
+          [](const Variable &self) {
+            return size_of(self, SizeofTag::Underlying);
+          },
+          py::call_guard<py::gil_scoped_release>());
 
   bind_common_operators(variable);
 
@@ -174,9 +179,12 @@ of variances.)");
     return core::callDType<GetElements>(
         structured_t{}, variableFactory().elem_dtype(self), self, key);
   });
-  m.def("_set_elements", [](Variable &self, const std::string &key,
-                            const Variable &elems) {
-    core::callDType<SetElements>(
-        structured_t{}, variableFactory().elem_dtype(self), self, key, elems);
-  });
+  m.def(
+      "_set_elements",
+      [](Variable &self, const std::string &key, const Variable &elems) {
+        core::callDType<SetElements>(structured_t{},
+                                     variableFactory().elem_dtype(self), self,
+                                     key, elems);
+      },
+      py::call_guard<py::gil_scoped_release>());
 }
@@ -6,6 +6,7 @@
 #include "scipp/core/tag_util.h"
 #include "scipp/dataset/dataset.h"
 #include "scipp/variable/creation.h"
+#include "scipp/variable/linear_range.h"
 
 #include "dtype.h"
 #include "py_object.h"
@@ -67,4 +68,12 @@ void init_creation(py::module &m) {
       },
       py::arg("dims"), py::arg("shape"), py::arg("unit") = units::one,
       py::arg("dtype") = py::none(), py::arg("with_variances") = std::nullopt);
+  m.def(
+      "arange",
+      [](const Dim dim, const variable::Variable &start,
+         const variable::Variable &stop, const variable::Variable &step) {
+        return variable::arange(dim, start, stop, step);
+      },
+      py::arg("dim"), py::arg("start"), py::arg("stop"), py::arg("step"),
+      py::call_guard<py::gil_scoped_release>());
 }
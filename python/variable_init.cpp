@@ -10,6 +10,7 @@
 #include "scipp/core/tag_util.h"
 #include "scipp/dataset/dataset.h"
 #include "scipp/units/string.h"
+#include "scipp/variable/element_array_model.h"
 #include "scipp/variable/to_unit.h"
 #include "scipp/variable/variable.h"
 
@@ -182,10 +183,91 @@ auto make_element_array(const Dimensions &dims, const py::object &source,
   }
 }
 
+/// Return the strides of `array` in units of elements if a Variable of given
+/// dims can use its memory directly.
+///
+/// This requires an aligned array with the native layout of T and positive
+/// strides. Strides of dimensions of extent 1 are irrelevant and replaced by
+/// those of a contiguous array.
+template <class T>
+std::optional<Strides> shareable_strides(const py::object &obj,
+                                         const Dimensions &dims) {
+  if (!py::isinstance<py::array_t<T>>(obj) || dims.volume() == 0)
+    return std::nullopt;
+  const auto array = py::reinterpret_borrow<py::array>(obj);
+  if (!(array.flags() & py::detail::npy_api::NPY_ARRAY_ALIGNED_))
+    return std::nullopt;
+  Strides strides(dims);
+  for (scipp::index d = 0; d < dims.ndim(); ++d) {
+    if (dims.size(d) == 1)
+      continue;
+    const auto stride = array.strides(d);
+    if (stride <= 0 || stride % static_cast<ssize_t>(sizeof(T)) != 0)
+      return std::nullopt;
+    strides[d] = stride / static_cast<ssize_t>(sizeof(T));
+  }
+  return strides;
+}
+
+inline bool is_writeable(const py::object &obj) {
+  return py::reinterpret_borrow<py::array>(obj).writeable();
+}
+
+template <class T>
+element_array<T> adopt_buffer(const py::object &obj, const scipp::index size) {
+  auto array = py::reinterpret_borrow<py::array>(obj);
+  // Read-only arrays are protected by making the variable read-only.
+  auto *data = const_cast<T *>(static_cast<const T *>(array.data()));
+  // PyObject acquires the GIL when releasing the array.
+  return element_array<T>(data, size,
+                          std::make_shared<python::PyObject>(array));
+}
+
+/// Return a variable using the memory of the NumPy arrays `values` and
+/// `variances` if possible.
+///
+/// Non-contiguous arrays are supported by means of the strides of the variable.
+/// Such variables behave like slices, e.g., their unit cannot be changed. If
+/// any of the arrays is read-only, e.g., when it references memory of an Arrow
+/// buffer, the variable is read-only as well.
+template <class T>
+std::optional<Variable>
+share_buffers(const Dimensions &dims, const py::object &values,
+              const py::object &variances, const units::Unit unit) {
+  if constexpr (ElementTypeMap<T>::convert || !std::is_arithmetic_v<T>) {
+    return std::nullopt;
+  } else {
+    const auto strides = shareable_strides<T>(values, dims);
+    if (!strides || (!variances.is_none() &&
+                     shareable_strides<T>(variances, dims) != strides))
+      return std::nullopt;
+    scipp::index size = 1;
+    for (scipp::index d = 0; d < dims.ndim(); ++d)
+      size += (dims.size(d) - 1) * (*strides)[d];
+    auto model = std::make_shared<ElementArrayModel<T>>(
+        size, unit, adopt_buffer<T>(values, size),
+        variances.is_none()
+            ? std::optional<element_array<T>>{}
+            : std::optional{adopt_buffer<T>(variances, size)});
+    // The buffer can be modified from Python without notifying the model.
+    model->disable_cache();
+    Variable variable(dims, std::move(model));
+    variable.unchecked_strides() = *strides;
+    if (!is_writeable(values) ||
+        (!variances.is_none() && !is_writeable(variances)))
+      return variable.as_const();
+    return variable;
+  }
+}
+
 template <class T> struct MakeVariable {
   static Variable apply(const Dimensions &dims, const py::object &values,
-                        const py::object &variances, const units::Unit unit) {
+                        const py::object &variances, const units::Unit unit,
+                        const bool copy) {
     const auto [values_unit, final_unit] = common_unit<T>(values, unit);
+    if (!copy)
+      if (auto shared = share_buffers<T>(dims, values, variances, values_unit))
+        return to_unit(*shared, final_unit, CopyPolicy::TryAvoid);
     auto values_array =
         Values(make_element_array<T>(dims, values, values_unit));
     auto variable = variances.is_none()
@@ -200,7 +282,7 @@ template <class T> struct MakeVariable {
 
 Variable make_variable(const py::object &dim_labels, const py::object &values,
                        const py::object &variances, const units::Unit unit,
-                       DType dtype) {
+                       DType dtype, const bool copy) {
   const auto converted_values = parse_data_sequence(dim_labels, values);
   const auto converted_variances = parse_data_sequence(dim_labels, variances);
   dtype = common_dtype(converted_values, converted_variances, dtype);
@@ -212,7 +294,7 @@ Variable make_variable(const py::object &dim_labels, const py::object &values,
                          python::PyObject>::apply<MakeVariable>(dtype, dims,
                                                                 values,
                                                                 variances,
-                                                                unit);
+                                                                unit, copy);
 }
 } // namespace
 
@@ -225,7 +307,7 @@ void bind_init(py::class_<Variable> &cls) {
       py::init([](const py::object &dim_labels, const py::object &values,
                   const py::object &variances,
                   const std::optional<units::Unit> unit,
-                  const py::object &dtype) {
+                  const py::object &dtype, const bool copy) {
         if (values.is_none() && variances.is_none()) {
           throw std::invalid_argument(
               "At least one argument of 'values' and 'variances' is required.");
@@ -233,11 +315,11 @@ void bind_init(py::class_<Variable> &cls) {
         const auto [scipp_dtype, actual_unit] =
             cast_dtype_and_unit(dtype, unit);
         return make_variable(dim_labels, values, variances, actual_unit,
-                             scipp_dtype);
+                             scipp_dtype, copy);
       }),
       py::kw_only(), py::arg("dims"), py::arg("values") = py::none(),
       py::arg("variances") = py::none(), py::arg("unit") = std::nullopt,
-      py::arg("dtype") = py::none(),
+      py::arg("dtype") = py::none(), py::arg("copy") = true,
       R"raw(
 Initialize a variable with values and/or variances.
 
@@ -253,6 +335,12 @@ if you want to preallocate memory to fill later, use :py:func:`scipp.empty`.
 :param dtype: Type of the variable's elements. Is deduced from other arguments
               in most cases. Defaults to ``sc.dtype.float64`` if no deduction is
               possible.
+:param copy: If ``False``, the variable uses the memory of NumPy arrays given
+             as ``values`` and ``variances`` instead of copying it, provided
+             that their dtype matches and their strides are positive. The
+             arrays are kept alive by the variable, which is read-only if any
+             of the arrays is read-only. Otherwise, or if this is not
+             possible, the data is copied.
 
 :type dims: Sequence[str]
 :type values: numpy.ArrayLike
@@ -261,6 +349,7 @@ if you want to preallocate memory to fill later, use :py:func:`scipp.empty`.
 :type variance: Any
 :type unit: scipp.Unit
 :type dtype: Any
+:type copy: bool
 
 :seealso: Specialized `creation functions <../reference/api.rst#creation-functions>`_,
  in particular :py:func:`scipp.array` and :py:func:`scipp.scalar`.
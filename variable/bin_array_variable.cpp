@@ -32,4 +32,34 @@ const scipp::index &index_value(const Variable &index) {
   return index.value<scipp::index>();
 }
 
+const scipp::index *offset_data(const Variable &offsets) {
+  return offsets.values<scipp::index>().data();
+}
+
+VariableConceptHandle indices_from_offsets(const Variable &offsets) {
+  const auto dim = offsets.dims().inner();
+  const auto size = offsets.dims()[dim] - 1;
+  return zip(offsets.slice({dim, 0, size}), offsets.slice({dim, 1, size + 1}))
+      .data_handle();
+}
+
+/// Return 1-D offsets if bins are contiguous, else an invalid variable.
+///
+/// Bins are contiguous if they are ordered and there are no gaps between bins
+/// in the order given by the dimensions of the indices.
+Variable offsets_from_indices(const Variable &indices) {
+  const auto ranges = indices.values<scipp::index_pair>();
+  Variable offsets = makeVariable<scipp::index>(
+      Dims{Dim::X}, Shape{indices.dims().volume() + 1});
+  auto out = offsets.values<scipp::index>().as_span();
+  out[0] = ranges.size() == 0 ? 0 : ranges.begin()->first;
+  scipp::index i = 0;
+  for (const auto &[begin, end] : ranges) {
+    if (begin != out[i] || end < begin)
+      return Variable{};
+    out[++i] = end;
+  }
+  return offsets;
+}
+
 } // namespace scipp::variable::bin_array_variable_detail
@@ -64,11 +64,12 @@ Variable sum_subbin_sizes(const Variable &var) {
 
 std::vector<scipp::index> flatten_subbin_sizes(const Variable &var,
                                                const scipp::index length) {
-  std::vector<scipp::index> flat;
+  std::vector<scipp::index> flat(var.dims().volume() * length);
+  auto it = flat.begin();
   for (const auto &val : var.values<core::SubbinSizes>()) {
-    flat.insert(flat.end(), val.sizes().begin(), val.sizes().end());
-    for (scipp::index i = 0; i < length - scipp::size(val.sizes()); ++i)
-      flat.push_back(0);
+    std::copy_n(val.sizes().begin(),
+                std::min(scipp::size(val.sizes()), length), it);
+    it += length;
   }
   return flat;
 }
@@ -4,12 +4,14 @@
 /// @author Simon Heybrock
 #include "scipp/core/element/arg_list.h"
 
+#include "scipp/variable/bin_array_model.h"
 #include "scipp/variable/bins.h"
 #include "scipp/variable/comparison.h"
 #include "scipp/variable/reduction.h"
 #include "scipp/variable/subspan_view.h"
 #include "scipp/variable/transform.h"
 #include "scipp/variable/util.h"
+#include "scipp/variable/variable_factory.h"
 
 #include "operations_common.h"
 
@@ -68,8 +70,10 @@ Variable resize_default_init(const Variable &var, const Dim dim,
 /// Each bin is represented by a VariableView. `indices` defines the array of
 /// bins as slices of `buffer` along `dim`.
 Variable make_bins(Variable indices, const Dim dim, Variable buffer) {
-  expect_valid_bin_indices(indices.data_handle(), dim, buffer.dims());
-  return make_bins_no_validate(std::move(indices), dim, buffer);
+  const bool monotonic =
+      expect_valid_bin_indices(indices.data_handle(), dim, buffer.dims());
+  return variable::make_bins_impl(std::move(indices), dim, std::move(buffer),
+                                  monotonic);
 }
 
 /// Construct a bin-variable over a variable without index validation.
@@ -78,7 +82,48 @@ Variable make_bins(Variable indices, const Dim dim, Variable buffer) {
 /// bins is acceptable.
 Variable make_bins_no_validate(Variable indices, const Dim dim,
                                Variable buffer) {
-  return variable::make_bins_impl(std::move(indices), dim, std::move(buffer));
+  return variable::make_bins_impl(std::move(indices), dim, std::move(buffer),
+                                  false);
+}
+
+/// Return true if the bin indices of `var` are known to be valid for its
+/// buffer, i.e., in range and without overlap, so bins can be rebuilt from them
+/// for a buffer of the same size without validating the indices again.
+///
+/// This uses the information recorded when validating the indices in
+/// `make_bins` and does not inspect them, i.e., a return value of false does
+/// not imply the opposite. Slices of such variables are also valid.
+bool has_validated_bin_indices(const Variable &var) {
+  if (!is_bins(var))
+    return false;
+  const auto *model =
+      dynamic_cast<const BinModelBase<VariableConceptHandle> *>(&var.data());
+  return model && model->indices_monotonic();
+}
+
+/// Return true if the space between bins of `var`, and after the last bin, is
+/// free and can be used to grow the bins in-place.
+///
+/// This is the case only if the buffer was allocated for `var` by an operation
+/// that reserves capacity, see `set_reserved_capacity`, and neither the indices
+/// nor the buffer have been modified by other means since.
+bool has_reserved_capacity(const Variable &var) {
+  if (!is_bins(var) || var.is_slice() ||
+      Strides(var.strides()) != Strides(var.dims()))
+    return false;
+  const auto *model =
+      dynamic_cast<const BinModelBase<VariableConceptHandle> *>(&var.data());
+  return model && model->has_reserved();
+}
+
+/// Record that the space between bins of `var` is free, see
+/// `has_reserved_capacity`.
+///
+/// Must be called only by operations that allocated the buffer of `var` and
+/// wrote its indices.
+void set_reserved_capacity(Variable &var) {
+  dynamic_cast<BinModelBase<VariableConceptHandle> &>(var.data())
+      .set_reserved();
 }
 
 } // namespace scipp::variable
@@ -0,0 +1,73 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @author Simon Heybrock
+#include "scipp/variable/constant.h"
+#include "scipp/core/tag_util.h"
+#include "scipp/core/time_point.h"
+#include "scipp/variable/element_array_model.h"
+
+namespace scipp::variable {
+
+template <class T> std::optional<T> constant_value(const Variable &var) {
+  if (var.dtype() != dtype<T>)
+    return std::nullopt;
+  const auto &constant =
+      static_cast<const ElementArrayModel<T> &>(var.data()).constant();
+  if (!constant)
+    return std::nullopt;
+  return constant->value;
+}
+
+template SCIPP_VARIABLE_EXPORT std::optional<double>
+constant_value(const Variable &);
+template SCIPP_VARIABLE_EXPORT std::optional<float>
+constant_value(const Variable &);
+template SCIPP_VARIABLE_EXPORT std::optional<int64_t>
+constant_value(const Variable &);
+template SCIPP_VARIABLE_EXPORT std::optional<int32_t>
+constant_value(const Variable &);
+template SCIPP_VARIABLE_EXPORT std::optional<bool>
+constant_value(const Variable &);
+template SCIPP_VARIABLE_EXPORT std::optional<core::time_point>
+constant_value(const Variable &);
+
+namespace {
+bool is_supported(const DType dtype) {
+  return dtype == core::dtype<double> || dtype == core::dtype<float> ||
+         dtype == core::dtype<int64_t> || dtype == core::dtype<int32_t> ||
+         dtype == core::dtype<bool> || dtype == core::dtype<core::time_point>;
+}
+
+template <class T> struct MakeConstant {
+  static Variable apply(const Dimensions &dims, const Variable &value) {
+    return Variable(dims, std::make_shared<ElementArrayModel<T>>(
+                              value.unit(),
+                              Constant<T>{value.value<T>(), dims.volume()}));
+  }
+};
+} // namespace
+
+bool has_constant_value(const Variable &var) {
+  return constant_value<double>(var) || constant_value<float>(var) ||
+         constant_value<int64_t>(var) || constant_value<int32_t>(var) ||
+         constant_value<bool>(var) || constant_value<core::time_point>(var);
+}
+
+Variable first_element(const Variable &var) {
+  auto out = var;
+  for (const auto &dim : var.dims().labels())
+    out = out.slice({dim, 0});
+  return out;
+}
+
+std::optional<Variable> make_constant(const Dimensions &dims,
+                                      const Variable &value) {
+  if (value.hasVariances() || !is_supported(value.dtype()))
+    return std::nullopt;
+  return core::CallDType<double, float, int64_t, int32_t, bool,
+                         core::time_point>::apply<MakeConstant>(value.dtype(),
+                                                                dims, value);
+}
+
+} // namespace scipp::variable
@@ -4,6 +4,7 @@
 /// @author Simon Heybrock
 #include "scipp/core/element/creation.h"
 #include "scipp/core/time_point.h"
+#include "scipp/variable/constant.h"
 #include "scipp/variable/creation.h"
 #include "scipp/variable/shape.h"
 #include "scipp/variable/transform.h"
@@ -44,10 +45,9 @@ Variable empty_like(const Variable &prototype,
   return variableFactory().empty_like(prototype, shape, sizes);
 }
 
-Variable special_like(const Variable &prototype, const FillValue &fill) {
+namespace {
+Variable fill_like(const Variable &prototype, const FillValue &fill) {
   const char *name = "special_like";
-  if (fill == FillValue::Default)
-    return Variable(prototype, prototype.dims());
   if (fill == FillValue::ZeroNotBool)
     return transform(prototype, core::element::zeros_not_bool_like, name);
   if (fill == FillValue::True)
@@ -61,5 +61,20 @@ Variable special_like(const Variable &prototype, const FillValue &fill) {
                      name);
   throw std::runtime_error("Unsupported fill value.");
 }
+} // namespace
+
+/// Create a variable with same parameters as prototype, filled with `fill`.
+///
+/// Unless `prototype` is binned or has variances, the fill value is stored only
+/// once, see Constant.
+Variable special_like(const Variable &prototype, const FillValue &fill) {
+  if (fill == FillValue::Default)
+    return Variable(prototype, prototype.dims());
+  if (prototype.dims().volume() > 1 && !is_bins(prototype))
+    if (auto out = make_constant(prototype.dims(),
+                                 fill_like(first_element(prototype), fill)))
+      return std::move(*out);
+  return fill_like(prototype, fill);
+}
 
 } // namespace scipp::variable
@@ -4,6 +4,10 @@
 /// @author Simon Heybrock
 #pragma once
 #include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <optional>
+#include <utility>
 
 #include "scipp/core/bucket_array_view.h"
 #include "scipp/core/dimensions.h"
@@ -17,12 +21,65 @@
 
 namespace scipp::variable {
 
+namespace bin_array_variable_detail {
+SCIPP_VARIABLE_EXPORT VariableConceptHandle
+indices_from_offsets(const Variable &offsets);
+} // namespace bin_array_variable_detail
+
+/// Base class for binned data.
+///
+/// Bin indices are stored either as (begin, end) pairs, or, for contiguous
+/// bins, as `size() + 1` offsets which require half the memory. The latter is
+/// converted into pairs on demand when `indices()` or `bin_indices()` is
+/// accessed, and the offsets are dropped. Once converted the pairs are
+/// authoritative since they may be shared with and modified via other
+/// variables. Conversion may happen concurrently from const accessors, so the
+/// offsets and pairs are only accessed while holding a lock.
+///
+/// Whether the indices are monotonic is determined when validating them on
+/// construction. This is recorded together with the generation of the indices,
+/// so the information is discarded as soon as they may have been modified. It
+/// is also discarded when the buffer is accessed for modification.
+///
+/// The space between bins and after the last bin can be used to grow bins only
+/// if it was allocated by this model, see `set_reserved`. Otherwise, e.g., if
+/// the buffer is shared with other variables, the space may be in use.
 template <class Indices> class BinModelBase : public VariableConcept {
 public:
-  BinModelBase(const VariableConceptHandle &indices, const Dim dim)
-      : VariableConcept(units::one), m_indices(indices), m_dim(dim) {}
+  BinModelBase(const VariableConceptHandle &indices, const Dim dim,
+               const bool monotonic = false)
+      : VariableConcept(units::one), m_indices(indices), m_dim(dim) {
+    if (monotonic)
+      m_monotonic_generation = m_indices->generation();
+  }
+  BinModelBase(Variable offsets, const Dim dim)
+      : VariableConcept(units::one), m_offsets(std::move(offsets)), m_dim(dim),
+        m_monotonic_generation(m_offsets.data().generation()) {}
+  BinModelBase(const BinModelBase &other) : VariableConcept(other) {
+    std::lock_guard lock(other.m_mutex);
+    m_indices = other.m_indices;
+    m_offsets = other.m_offsets;
+    m_dim = other.m_dim;
+    m_monotonic_generation = other.m_monotonic_generation;
+  }
+  BinModelBase &operator=(const BinModelBase &other) {
+    if (this == &other)
+      return *this;
+    VariableConcept::operator=(other);
+    std::scoped_lock lock(m_mutex, other.m_mutex);
+    m_indices = other.m_indices;
+    m_offsets = other.m_offsets;
+    m_dim = other.m_dim;
+    m_monotonic_generation = other.m_monotonic_generation;
+    // The buffer of `other` is shared and not reserved for this model.
+    m_reserved_generation.reset();
+    return *this;
+  }
 
-  scipp::index size() const override { return indices()->size(); }
+  scipp::index size() const override {
+    std::lock_guard lock(m_mutex);
+    return m_indices ? m_indices->size() : m_offsets.dims().volume() - 1;
+  }
 
   void setUnit(const units::Unit &unit) override {
     if (unit != units::one)
@@ -34,13 +91,84 @@ public:
   bool hasVariances() const noexcept override { return false; }
   const Indices &bin_indices() const override { return indices(); }
 
-  const auto &indices() const { return m_indices; }
-  auto &indices() { return m_indices; }
+  const Indices &indices() const {
+    std::lock_guard lock(m_mutex);
+    if (!m_indices) {
+      const bool monotonic = is_monotonic(m_offsets.data());
+      m_indices = bin_array_variable_detail::indices_from_offsets(m_offsets);
+      m_monotonic_generation =
+          monotonic ? m_indices->generation() : std::nullopt;
+      // Views obtained from array_params keep the offsets alive if required.
+      m_offsets = Variable{};
+    }
+    return m_indices;
+  }
+  /// Return the indices for modification, which discards the information
+  /// whether they are monotonic.
+  Indices &indices() {
+    std::as_const(*this).indices();
+    std::lock_guard lock(m_mutex);
+    m_monotonic_generation.reset();
+    return m_indices;
+  }
   Dim bin_dim() const noexcept { return m_dim; }
 
+  /// Return the bin offsets if bins are stored in compact form and have not
+  /// been converted to index pairs, else an invalid variable.
+  Variable offsets() const {
+    std::lock_guard lock(m_mutex);
+    return m_offsets;
+  }
+
+  /// Record that the buffer was allocated for this model, i.e., that the space
+  /// between bins and after the last bin is free and may be used to grow bins.
+  /// Must only be called after creating the buffer and setting the indices.
+  void set_reserved() {
+    const auto &handle = indices();
+    std::lock_guard lock(m_mutex);
+    m_reserved_generation = handle->generation();
+  }
+
+  /// True if the space between bins is free, see `set_reserved`. Returns false
+  /// if the indices or the buffer may have been modified since.
+  bool has_reserved() const {
+    std::lock_guard lock(m_mutex);
+    return m_indices && m_reserved_generation.has_value() &&
+           m_reserved_generation == m_indices->generation();
+  }
+
+  /// True if the indices are known to be monotonic, i.e., bins do not overlap
+  /// and are stored in the buffer in the same order as the indices in memory.
+  /// Returns false if this is unknown, e.g., since the indices or the buffer
+  /// were modified after validation.
+  bool indices_monotonic() const {
+    std::lock_guard lock(m_mutex);
+    return is_monotonic(m_indices ? *m_indices : m_offsets.data());
+  }
+
+protected:
+  /// Discard the information about the layout of bins in the buffer, i.e.,
+  /// whether the indices are monotonic and whether space was reserved. Must be
+  /// called when handing out the buffer for modification, since it may be
+  /// replaced by a buffer of different size.
+  void discard_layout() {
+    std::lock_guard lock(m_mutex);
+    m_monotonic_generation.reset();
+    m_reserved_generation.reset();
+  }
+
 private:
-  Indices m_indices;
+  bool is_monotonic(const VariableConcept &indices) const noexcept {
+    return m_monotonic_generation.has_value() &&
+           m_monotonic_generation == indices.generation();
+  }
+
+  mutable std::mutex m_mutex;
+  mutable Indices m_indices;
+  mutable Variable m_offsets;
   Dim m_dim;
+  std::optional<uint64_t> m_monotonic_generation;
+  std::optional<uint64_t> m_reserved_generation;
 };
 
 /// Specialization of ElementArrayModel for "binned" data. T could be Variable,
@@ -56,7 +184,9 @@ public:
   using value_type = bucket<T>;
   using range_type = typename bucket<T>::range_type;
 
-  BinArrayModel(const VariableConceptHandle &indices, const Dim dim, T buffer);
+  BinArrayModel(const VariableConceptHandle &indices, const Dim dim, T buffer,
+                const bool monotonic = false);
+  BinArrayModel(Variable offsets, const Dim dim, T buffer);
 
   [[nodiscard]] VariableConceptHandle clone() const override;
 
@@ -86,7 +216,10 @@ public:
   // TODO Should the mutable version return a view to prevent risk of clients
   // breaking invariants of variable?
   const T &buffer() const noexcept { return m_buffer; }
-  T &buffer() noexcept { return m_buffer; }
+  T &buffer() {
+    this->discard_layout();
+    return m_buffer;
+  }
 
   ElementArrayView<bucket<T>> values(const core::ElementArrayViewParams &base) {
     return {index_values(base), this->bin_dim(), m_buffer};
@@ -119,14 +252,6 @@ bool BinArrayModel<T>::equals(const Variable &a, const Variable &b) const {
          equals_impl(a.values<bucket<T>>(), b.values<bucket<T>>());
 }
 
-template <class T>
-void BinArrayModel<T>::copy(const Variable &src, Variable &dest) const {
-  const auto &[indices0, dim0, buffer0] = src.constituents<T>();
-  auto &&[indices1, dim1, buffer1] = dest.constituents<T>();
-  static_cast<void>(dim1);
-  copy_slices(buffer0, buffer1, dim0, indices0, indices1);
-}
-
 template <class T>
 void BinArrayModel<T>::copy(const Variable &src, Variable &&dest) const {
   copy(src, dest);
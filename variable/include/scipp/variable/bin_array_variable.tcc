@@ -26,6 +26,8 @@ SCIPP_VARIABLE_EXPORT const scipp::index_pair *
 index_pair_data(const Variable &indices);
 SCIPP_VARIABLE_EXPORT scipp::index size_from_end_index(const Variable &end);
 SCIPP_VARIABLE_EXPORT const scipp::index &index_value(const Variable &index);
+SCIPP_VARIABLE_EXPORT const scipp::index *offset_data(const Variable &offsets);
+SCIPP_VARIABLE_EXPORT Variable offsets_from_indices(const Variable &indices);
 } // namespace bin_array_variable_detail
 
 template <class T> std::tuple<Variable, Dim, T> Variable::to_constituents() {
@@ -42,6 +44,8 @@ template <class T> std::tuple<Variable, Dim, T> Variable::constituents() const {
 
 template <class T> std::tuple<Variable, Dim, T> Variable::constituents() {
   auto &model = requireT<BinArrayModel<T>>(data());
+  // Indices may be modified via the returned variable, drop offsets.
+  static_cast<void>(model.indices());
   return {bin_indices(), model.bin_dim(), model.buffer()};
 }
 
@@ -55,6 +59,26 @@ template <class T> T &Variable::bin_buffer() {
   return model.buffer();
 }
 
+/// Return bin indices of `var` without storing them in the model if it holds
+/// offsets, since this would increase its memory footprint.
+template <class T> Variable bin_indices_view(const Variable &var) {
+  const auto &model = requireT<const BinArrayModel<T>>(var.data());
+  if (const auto offsets = model.offsets(); offsets.is_valid()) {
+    auto indices = var;
+    indices.setDataHandle(
+        bin_array_variable_detail::indices_from_offsets(offsets));
+    return indices;
+  }
+  return var.bin_indices();
+}
+
+template <class T>
+Variable make_bins_impl(Variable indices, const Dim dim, T &&buffer,
+                        const bool monotonic);
+template <class T>
+Variable make_bins_contiguous(const Variable &indices, const Dim dim,
+                              T &&buffer);
+
 template <class T> class BinVariableMakerCommon : public AbstractVariableMaker {
 public:
   [[nodiscard]] bool is_bins() const override { return true; }
@@ -74,7 +98,8 @@ public:
     const auto end = cumsum(sizes_);
     const auto begin = end - sizes_;
     const auto size = bin_array_variable_detail::index_value(sum(end - begin));
-    return make_bins(zip(begin, end), dim, resize_default_init(buf, dim, size));
+    return make_bins_contiguous(zip(begin, end), dim,
+                                resize_default_init(buf, dim, size));
   }
 };
 
@@ -119,23 +144,23 @@ public:
                   const typename AbstractVariableMaker::parent_list &parents)
       const override {
     const Variable &parent = bin_parent(parents);
-    const auto &[parentIndices, dim, buffer] = parent.constituents<T>();
-    auto [indices, size] =
-        bin_array_variable_detail::contiguous_indices(parentIndices, dims);
-    auto bufferDims = buffer.dims();
+    const auto dim = elem_dim(parent);
+    auto [indices, size] = bin_array_variable_detail::contiguous_indices(
+        bin_indices_view<T>(parent), dims);
+    auto bufferDims = buffer(parent).dims();
     bufferDims.resize(dim, size);
     return call_make_bins(parent, indices, dim, elem_dtype, bufferDims, unit,
                           variances);
   }
 
   Dim elem_dim(const Variable &var) const override {
-    return std::get<1>(var.constituents<T>());
+    return requireT<const BinArrayModel<T>>(var.data()).bin_dim();
   }
   DType elem_dtype(const Variable &var) const override {
-    return std::get<2>(var.constituents<T>()).dtype();
+    return buffer(var).dtype();
   }
   units::Unit elem_unit(const Variable &var) const override {
-    return std::get<2>(var.constituents<T>()).unit();
+    return buffer(var).unit();
   }
   void expect_can_set_elem_unit(const Variable &var,
                                 const units::Unit &u) const override {
@@ -144,32 +169,47 @@ public:
                               "used to change the unit.");
   }
   void set_elem_unit(Variable &var, const units::Unit &u) const override {
-    std::get<2>(var.constituents<T>()).setUnit(u);
+    buffer(var).setUnit(u);
   }
   bool hasVariances(const Variable &var) const override {
-    return std::get<2>(var.constituents<T>()).hasVariances();
+    return buffer(var).hasVariances();
   }
   core::ElementArrayViewParams
   array_params(const Variable &var) const override {
-    const auto &[indices, dim, buffer] = var.constituents<T>();
+    const auto &model = requireT<const BinArrayModel<T>>(var.data());
+    core::BucketParams bucket_params{model.bin_dim(), model.buffer().dims()};
+    if (const auto offsets = model.offsets(); offsets.is_valid()) {
+      bucket_params.offsets =
+          bin_array_variable_detail::offset_data(offsets) + var.offset();
+      bucket_params.offsets_owner = offsets.data_handle();
+    } else
+      bucket_params.indices =
+          bin_array_variable_detail::index_pair_data(var.bin_indices());
     auto params = var.array_params();
     return {0, // no offset required in buffer since access via indices
-            params.dims(),
-            params.strides(),
-            {dim, buffer.dims(),
-             bin_array_variable_detail ::index_pair_data(indices)}};
+            params.dims(), params.strides(), bucket_params};
   }
 };
 
 template <class T> BinArrayModel<T> copy(const BinArrayModel<T> &model) {
+  if (const auto offsets = model.offsets(); offsets.is_valid())
+    return BinArrayModel<T>(copy(offsets), model.bin_dim(),
+                            copy(model.buffer()));
   return BinArrayModel<T>(model.indices()->clone(), model.bin_dim(),
-                          copy(model.buffer()));
+                          copy(model.buffer()), model.indices_monotonic());
 }
 
 template <class T>
 BinArrayModel<T>::BinArrayModel(const VariableConceptHandle &indices,
-                                const Dim dim, T buffer)
-    : BinModelBase<Indices>(indices, dim), m_buffer(std::move(buffer)) {}
+                                const Dim dim, T buffer, const bool monotonic)
+    : BinModelBase<Indices>(indices, dim, monotonic),
+      m_buffer(std::move(buffer)) {}
+
+/// Construct from contiguous bins given by `size() + 1` offsets.
+template <class T>
+BinArrayModel<T>::BinArrayModel(Variable offsets, const Dim dim, T buffer)
+    : BinModelBase<Indices>(std::move(offsets), dim),
+      m_buffer(std::move(buffer)) {}
 
 template <class T> VariableConceptHandle BinArrayModel<T>::clone() const {
   return std::make_shared<BinArrayModel<T>>(variable::copy(*this));
@@ -192,7 +232,7 @@ VariableConceptHandle
 BinArrayModel<T>::makeDefaultFromParent(const scipp::index size) const {
   return std::make_shared<BinArrayModel>(
       makeVariable<range_type>(Dims{Dim::X}, Shape{size}).data_handle(),
-      this->bin_dim(), T{m_buffer.slice({this->bin_dim(), 0, 0})});
+      this->bin_dim(), T{m_buffer.slice({this->bin_dim(), 0, 0})}, true);
 }
 
 template <class T>
@@ -201,9 +241,19 @@ BinArrayModel<T>::makeDefaultFromParent(const Variable &shape) const {
   const auto end = cumsum(shape);
   const auto begin = end - shape;
   const auto size = bin_array_variable_detail::size_from_end_index(end);
-  return std::make_shared<BinArrayModel>(
+  auto model = std::make_shared<BinArrayModel>(
       zip(begin, begin).data_handle(), this->bin_dim(),
-      resize_default_init(m_buffer, this->bin_dim(), size));
+      resize_default_init(m_buffer, this->bin_dim(), size), true);
+  // The bins are empty and the new buffer provides space for growing them.
+  model->set_reserved();
+  return model;
+}
+
+template <class T>
+void BinArrayModel<T>::copy(const Variable &src, Variable &dest) const {
+  const auto dim = requireT<const BinArrayModel<T>>(src.data()).bin_dim();
+  copy_slices(src.bin_buffer<T>(), dest.bin_buffer<T>(), dim,
+              bin_indices_view<T>(src), bin_indices_view<T>(dest));
 }
 
 template <class T> void BinArrayModel<T>::assign(const VariableConcept &other) {
@@ -218,12 +268,28 @@ BinArrayModel<T>::index_values(const core::ElementArrayViewParams &base) const {
 }
 
 template <class T>
-Variable make_bins_impl(Variable indices, const Dim dim, T &&buffer) {
+Variable make_bins_impl(Variable indices, const Dim dim, T &&buffer,
+                        const bool monotonic) {
   indices.setDataHandle(std::make_unique<variable::BinArrayModel<T>>(
-      indices.data_handle(), dim, std::move(buffer)));
+      indices.data_handle(), dim, std::move(buffer), monotonic));
   return indices;
 }
 
+/// Make binned variable from bins that are contiguous by construction.
+///
+/// If possible, the indices are stored as offsets, otherwise as given. Unlike
+/// `make_bins` this does not share the indices with the input.
+template <class T>
+Variable make_bins_contiguous(const Variable &indices, const Dim dim,
+                              T &&buffer) {
+  auto offsets = bin_array_variable_detail::offsets_from_indices(indices);
+  if (!offsets.is_valid())
+    return make_bins_impl(copy(indices), dim, std::forward<T>(buffer), true);
+  return Variable(indices.dims(),
+                  std::make_shared<variable::BinArrayModel<T>>(
+                      std::move(offsets), dim, std::forward<T>(buffer)));
+}
+
 /// Macro for instantiating classes and functions required for support a new
 /// bin dtype in Variable.
 #define INSTANTIATE_BIN_ARRAY_VARIABLE(name, ...)                              \
@@ -233,7 +299,9 @@ Variable make_bins_impl(Variable indices, const Dim dim, T &&buffer) {
   template SCIPP_EXPORT BinArrayModel<__VA_ARGS__> copy(                       \
       const BinArrayModel<__VA_ARGS__> &);                                     \
   template SCIPP_EXPORT Variable make_bins_impl(Variable, const Dim,           \
-                                                __VA_ARGS__ &&);               \
+                                                __VA_ARGS__ &&, const bool);   \
+  template SCIPP_EXPORT Variable make_bins_contiguous(                         \
+      const Variable &, const Dim, __VA_ARGS__ &&);                            \
   template class SCIPP_EXPORT BinArrayModel<__VA_ARGS__>;                      \
   INSTANTIATE_VARIABLE_BASE(name, core::bin<__VA_ARGS__>)                      \
   template SCIPP_EXPORT std::tuple<Variable, Dim, __VA_ARGS__>                 \
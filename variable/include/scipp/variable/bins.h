@@ -23,4 +23,12 @@ SCIPP_VARIABLE_EXPORT void copy_slices(const Variable &src, Variable dst,
 [[nodiscard]] SCIPP_VARIABLE_EXPORT Variable
 make_bins_no_validate(Variable indices, const Dim dim, Variable buffer);
 
+[[nodiscard]] SCIPP_VARIABLE_EXPORT bool
+has_validated_bin_indices(const Variable &var);
+
+[[nodiscard]] SCIPP_VARIABLE_EXPORT bool
+has_reserved_capacity(const Variable &var);
+
+SCIPP_VARIABLE_EXPORT void set_reserved_capacity(Variable &var);
+
 } // namespace scipp::variable
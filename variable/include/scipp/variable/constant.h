@@ -0,0 +1,44 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @author Simon Heybrock
+#pragma once
+
+#include <optional>
+
+#include "scipp-variable_export.h"
+#include "scipp/common/index.h"
+#include "scipp/variable/variable.h"
+
+namespace scipp::variable {
+
+/// `size` elements sharing a single value.
+template <class T> struct Constant {
+  T value;
+  scipp::index size;
+};
+
+/// Return the value of all elements of `var`, if its values are stored as a
+/// single value and have not been written since.
+template <class T>
+[[nodiscard]] SCIPP_VARIABLE_EXPORT std::optional<T>
+constant_value(const Variable &var);
+
+/// Return true if `var` has a constant value of any supported dtype.
+[[nodiscard]] SCIPP_VARIABLE_EXPORT bool
+has_constant_value(const Variable &var);
+
+/// Return a 0-D view of the first element of `var`.
+[[nodiscard]] SCIPP_VARIABLE_EXPORT Variable
+first_element(const Variable &var);
+
+/// Return a variable with given dims, storing the value of 0-D `value` only
+/// once, if the dtype of `value` is supported and it has no variances.
+///
+/// This is used only by functions creating new arrays of identical values,
+/// such as `special_like`, which includes resizing with a fill value and
+/// creating masks. Copies and results of operations store every element.
+[[nodiscard]] SCIPP_VARIABLE_EXPORT std::optional<Variable>
+make_constant(const Dimensions &dims, const Variable &value);
+
+} // namespace scipp::variable
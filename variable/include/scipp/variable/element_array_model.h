@@ -7,11 +7,17 @@
 #include "scipp/core/dimensions.h"
 #include "scipp/core/element_array_view.h"
 #include "scipp/core/except.h"
+#include "scipp/core/strided_copy.h"
 #include "scipp/units/unit.h"
+#include "scipp/variable/constant.h"
 #include "scipp/variable/except.h"
+#include "scipp/variable/linear_range.h"
 #include "scipp/variable/transform.h"
 #include "scipp/variable/variable_concept.h"
+#include <atomic>
+#include <mutex>
 #include <optional>
+#include <utility>
 
 namespace scipp::variable {
 
@@ -31,6 +37,10 @@ bool equals_impl(const T1 &view1, const T2 &view2) {
 }
 
 /// Implementation of VariableConcept that holds an array with element type T.
+///
+/// Values may alternatively be given by a LinearRange or a Constant, in which
+/// case the array is only allocated and filled when the values are accessed.
+/// Write access drops the range or constant.
 template <class T> class ElementArrayModel : public VariableConcept {
 public:
   using value_type = T;
@@ -38,10 +48,16 @@ public:
   ElementArrayModel(const scipp::index size, const units::Unit &unit,
                     element_array<T> model,
                     std::optional<element_array<T>> variances = std::nullopt);
+  ElementArrayModel(const units::Unit &unit, const LinearRange<T> &range);
+  ElementArrayModel(const units::Unit &unit, const Constant<T> &constant);
+  ElementArrayModel(const ElementArrayModel &other);
+  ElementArrayModel &operator=(const ElementArrayModel &other);
 
   static DType static_dtype() noexcept { return scipp::dtype<T>; }
   DType dtype() const noexcept override { return scipp::dtype<T>; }
-  scipp::index size() const override { return m_values.size(); }
+  scipp::index size() const override {
+    return is_lazy() ? lazy_size() : scipp::size(m_values);
+  }
 
   VariableConceptHandle
   makeDefaultFromParent(const scipp::index size) const override;
@@ -65,9 +81,11 @@ public:
   }
 
   auto values(const core::ElementArrayViewParams &base) const {
-    return ElementArrayView(base, m_values.data());
+    materialize();
+    return ElementArrayView(base, std::as_const(m_values).data());
   }
   auto values(const core::ElementArrayViewParams &base) {
+    prepare_write();
     return ElementArrayView(base, m_values.data());
   }
   auto variances(const core::ElementArrayViewParams &base) const {
@@ -76,19 +94,35 @@ public:
   }
   auto variances(const core::ElementArrayViewParams &base) {
     expectHasVariances();
+    prepare_write();
     return ElementArrayView(base, m_variances->data());
   }
 
+  /// Return the range generating the values, unless they have been written.
+  std::optional<LinearRange<T>> linear_range() const {
+    std::lock_guard lock(m_lazy_mutex);
+    return m_range;
+  }
+  /// Return the value shared by all elements, unless they have been written.
+  std::optional<Constant<T>> constant() const {
+    std::lock_guard lock(m_lazy_mutex);
+    return m_constant;
+  }
+
+  void disable_cache() override;
+
   scipp::index dtype_size() const override { return sizeof(T); }
   const VariableConceptHandle &bin_indices() const override {
     throw except::TypeError("This data type does not have bin indices.");
   }
 
   scipp::span<const T> values() const {
+    materialize();
     return {m_values.data(), m_values.data() + m_values.size()};
   }
 
   scipp::span<T> values() {
+    prepare_write();
     return {m_values.data(), m_values.data() + m_values.size()};
   }
 
@@ -97,13 +131,65 @@ private:
     if (!hasVariances())
       throw except::VariancesError("Variable does not have variances.");
   }
-  element_array<T> m_values;
+  bool is_lazy() const noexcept {
+    return m_lazy.load(std::memory_order_acquire);
+  }
+  scipp::index lazy_size() const {
+    std::lock_guard lock(m_lazy_mutex);
+    if (m_range)
+      return m_range->size;
+    if (m_constant)
+      return m_constant->size;
+    // Materialized concurrently.
+    return scipp::size(m_values);
+  }
+  void materialize() const {
+    if (is_lazy())
+      materialize_lazy();
+  }
+  void materialize_lazy() const;
+  void drop_generators();
+  void prepare_write() {
+    if (m_generated.load(std::memory_order_acquire))
+      drop_generators();
+    begin_write();
+  }
+  mutable element_array<T> m_values;
   std::optional<element_array<T>> m_variances;
+  std::optional<LinearRange<T>> m_range;
+  std::optional<Constant<T>> m_constant;
+  mutable std::atomic<bool> m_lazy{false};
+  std::atomic<bool> m_generated{false};
+  mutable std::mutex m_lazy_mutex;
 };
 
 namespace {
 template <class T> auto copy(const T &x) { return x; }
 constexpr auto do_copy = [](auto &a, const auto &b) { a = copy(b); };
+
+/// Copy `src` to `dest` using strided_copy if both have the same dtype, dims,
+/// and presence of variances, and do not overlap. Return false otherwise.
+template <class T> bool try_strided_copy(const Variable &src, Variable &dest) {
+  if (dest.dtype() != dtype<T> || dest.dims() != src.dims() ||
+      dest.hasVariances() != src.hasVariances())
+    return false;
+  dest.expectCanSetUnit(src.unit());
+  const auto src_values = src.values<T>();
+  auto dest_values = dest.values<T>();
+  if (dest_values.overlaps(src_values))
+    return false;
+  const auto shape = dest.dims().shape();
+  core::strided_copy(shape, src_values.data(), src.strides(),
+                     dest_values.data(), dest.strides());
+  if (src.hasVariances()) {
+    const auto src_variances = src.variances<T>();
+    auto dest_variances = dest.variances<T>();
+    core::strided_copy(shape, src_variances.data(), src.strides(),
+                       dest_variances.data(), dest.strides());
+  }
+  dest.setUnit(src.unit());
+  return true;
+}
 } // namespace
 
 /// Helper for implementing Variable(View) copy operations.
@@ -112,6 +198,11 @@ constexpr auto do_copy = [](auto &a, const auto &b) { a = copy(b); };
 /// transform can be called with any T.
 template <class T>
 void ElementArrayModel<T>::copy(const Variable &src, Variable &dest) const {
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    const ScopedWrite write(dest.data());
+    if (try_strided_copy<T>(src, dest))
+      return;
+  }
   transform_in_place<T>(
       dest, src,
       overloaded{core::transform_flags::expect_in_variance_if_out_variance,
@@ -2,6 +2,7 @@
 // Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
 /// @file
 /// @author Simon Heybrock
+#include "scipp/core/parallel.h"
 #include "scipp/variable/element_array_model.h"
 #include "scipp/variable/variable.tcc"
 
@@ -82,6 +83,117 @@ ElementArrayModel<T>::ElementArrayModel(
     *m_variances = element_array<T>(size, default_init<T>::value());
 }
 
+template <class T>
+ElementArrayModel<T>::ElementArrayModel(const units::Unit &unit,
+                                        const LinearRange<T> &range)
+    : VariableConcept(unit), m_range(range), m_lazy(true), m_generated(true) {
+  if constexpr (!std::is_arithmetic_v<T> || std::is_same_v<T, bool>)
+    throw except::TypeError("Linear ranges require a numeric dtype.");
+}
+
+template <class T>
+ElementArrayModel<T>::ElementArrayModel(const units::Unit &unit,
+                                        const Constant<T> &constant)
+    : VariableConcept(unit), m_constant(constant), m_lazy(true),
+      m_generated(true) {}
+
+template <class T>
+ElementArrayModel<T>::ElementArrayModel(const ElementArrayModel &other)
+    : VariableConcept(other), m_variances(other.m_variances) {
+  std::lock_guard lock(other.m_lazy_mutex);
+  m_range = other.m_range;
+  m_constant = other.m_constant;
+  m_lazy.store(other.is_lazy(), std::memory_order_release);
+  m_generated.store(other.m_generated.load(), std::memory_order_release);
+  if (!m_lazy)
+    m_values = other.m_values;
+}
+
+template <class T>
+ElementArrayModel<T> &
+ElementArrayModel<T>::operator=(const ElementArrayModel &other) {
+  if (this == &other)
+    return *this;
+  VariableConcept::operator=(other);
+  std::scoped_lock lock(m_lazy_mutex, other.m_lazy_mutex);
+  const bool lazy = other.is_lazy();
+  m_values = lazy ? element_array<T>() : other.m_values;
+  m_variances = other.m_variances;
+  m_range = other.m_range;
+  m_constant = other.m_constant;
+  m_lazy.store(lazy, std::memory_order_release);
+  m_generated.store(other.m_generated.load(), std::memory_order_release);
+  return *this;
+}
+
+/// Allocate and fill the values from the linear range or constant.
+///
+/// This may be called concurrently from const accessors. The values are filled
+/// without holding the lock, since filling may run parallel tasks which could
+/// in turn materialize other models, and only published under the lock. The
+/// range or constant is kept since the values are unchanged.
+template <class T> void ElementArrayModel<T>::materialize_lazy() const {
+  std::optional<LinearRange<T>> range;
+  std::optional<Constant<T>> constant;
+  {
+    std::lock_guard lock(m_lazy_mutex);
+    if (!is_lazy())
+      return;
+    range = m_range;
+    constant = m_constant;
+  }
+  element_array<T> values;
+  if (constant) {
+    values = element_array<T>(constant->size, constant->value);
+  } else if constexpr (std::is_arithmetic_v<T> && !std::is_same_v<T, bool>) {
+    values = element_array<T>(range->size, core::init_for_overwrite);
+    core::parallel::parallel_for(
+        core::parallel::blocked_range(0, range->size),
+        [&](const auto &block) {
+          for (auto i = block.begin(); i != block.end(); ++i)
+            values.data()[i] = (*range)[i];
+        });
+  }
+  std::lock_guard lock(m_lazy_mutex);
+  if (!is_lazy())
+    return; // Materialized concurrently.
+  m_values = std::move(values);
+  m_lazy.store(false, std::memory_order_release);
+}
+
+/// Materialize the values and drop the range or constant before writing.
+///
+/// Writes to different slices may happen concurrently, e.g., from parallel
+/// tasks writing to slices of an accumulant. The values are therefore filled
+/// while holding the lock, so they are filled only once and other writers wait
+/// for them. This does not run parallel tasks, which could otherwise attempt to
+/// acquire the lock again while it is held by the same thread.
+template <class T> void ElementArrayModel<T>::drop_generators() {
+  std::lock_guard lock(m_lazy_mutex);
+  if (!m_generated.load(std::memory_order_acquire))
+    return; // Dropped concurrently.
+  if (is_lazy()) {
+    if (m_constant) {
+      m_values = element_array<T>(m_constant->size, m_constant->value);
+    } else if constexpr (std::is_arithmetic_v<T> && !std::is_same_v<T, bool>) {
+      m_values = element_array<T>(m_range->size, core::init_for_overwrite);
+      for (scipp::index i = 0; i < m_range->size; ++i)
+        m_values.data()[i] = (*m_range)[i];
+    }
+    m_lazy.store(false, std::memory_order_release);
+  }
+  m_range.reset();
+  m_constant.reset();
+  m_generated.store(false, std::memory_order_release);
+}
+
+/// Disable caching and drop the range or constant, since writes through
+/// exposed buffers cannot be tracked.
+template <class T> void ElementArrayModel<T>::disable_cache() {
+  prepare_write();
+  VariableConcept::disable_cache();
+}
+
 template <class T> VariableConceptHandle ElementArrayModel<T>::clone() const {
   return std::make_shared<ElementArrayModel<T>>(*this);
 }
@@ -116,14 +228,15 @@ template <class T>
 void ElementArrayModel<T>::setVariances(const Variable &variances) {
   if (!core::canHaveVariances<T>())
     throw except::VariancesError("This data type cannot have variances.");
+  invalidate_cache();
   if (!variances.is_valid())
     return m_variances.reset();
   // TODO Could move if refcount is 1?
   if (variances.hasVariances())
     throw except::VariancesError(
         "Cannot set variances from variable with variances.");
-  m_variances.emplace(
-      requireT<const ElementArrayModel>(variances.data()).m_values);
+  const auto &other = requireT<const ElementArrayModel>(variances.data());
+  m_variances.emplace(other.values().begin(), other.values().end());
 }
 
 /// Macro for instantiating classes and functions required for support a new
@@ -0,0 +1,58 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @author Simon Heybrock
+#pragma once
+
+#include <optional>
+
+#include "scipp-variable_export.h"
+#include "scipp/common/index.h"
+#include "scipp/variable/variable.h"
+
+namespace scipp::variable {
+
+/// Linearly spaced values, generated on demand.
+///
+/// The last value is stored explicitly such that, e.g., the endpoint of a
+/// linspace is exact.
+template <class T> struct LinearRange {
+  T start;
+  T step;
+  T last;
+  scipp::index size;
+
+  T operator[](const scipp::index i) const {
+    return i + 1 == size ? last : static_cast<T>(start + i * step);
+  }
+};
+
+/// Return the linear range spanned by the values of `var`, if its values are
+/// generated on demand and have not been written since.
+///
+/// Only 0-D and 1-D variables are supported. Slices of integer ranges are
+/// supported, slices of floating-point ranges only if the values of the slice
+/// match those of the range exactly, i.e., for the full range and for slices
+/// with at most two elements.
+template <class T>
+[[nodiscard]] SCIPP_VARIABLE_EXPORT std::optional<LinearRange<T>>
+linear_range(const Variable &var);
+
+/// Return true if `var` has a linear range of any supported dtype.
+[[nodiscard]] SCIPP_VARIABLE_EXPORT bool
+has_linear_range(const Variable &var);
+
+/// Return the sign of the step of the linear range of `var`, if it has one.
+[[nodiscard]] SCIPP_VARIABLE_EXPORT std::optional<int>
+linear_range_direction(const Variable &var);
+
+/// Return a copy of `var` that generates its values from a linear range, if
+/// `var` has one and no variances.
+[[nodiscard]] SCIPP_VARIABLE_EXPORT std::optional<Variable>
+copy_linear_range(const Variable &var);
+
+[[nodiscard]] SCIPP_VARIABLE_EXPORT Variable
+arange(const Dim dim, const Variable &start, const Variable &stop,
+       const Variable &step);
+
+} // namespace scipp::variable
@@ -15,4 +15,7 @@ namespace scipp::variable {
                                                   const Dim dim,
                                                   const SortOrder order);
 
+[[nodiscard]] SCIPP_VARIABLE_EXPORT Variable
+argsort(const Variable &key, const SortOrder order = SortOrder::Ascending);
+
 } // namespace scipp::variable
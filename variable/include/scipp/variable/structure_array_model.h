@@ -69,18 +69,36 @@ public:
     return ElementArrayView(base, get_values());
   }
   auto values(const core::ElementArrayViewParams &base) {
+    m_elements->begin_write();
     return ElementArrayView(base, get_values());
   }
 
   VariableConceptHandle elements() const { return m_elements; }
 
+  void begin_tracked_write() const noexcept override {
+    VariableConcept::begin_tracked_write();
+    m_elements->begin_tracked_write();
+  }
+  void end_tracked_write() const noexcept override {
+    VariableConcept::end_tracked_write();
+    m_elements->end_tracked_write();
+  }
+
+  void disable_cache() override {
+    VariableConcept::disable_cache();
+    m_elements->disable_cache();
+  }
+
   scipp::index dtype_size() const override { return sizeof(T); }
   const VariableConceptHandle &bin_indices() const override {
     throw except::TypeError("This data type does not have bin indices.");
   }
 
   scipp::span<const T> values() const { return {get_values(), size()}; }
-  scipp::span<T> values() { return {get_values(), size()}; }
+  scipp::span<T> values() {
+    m_elements->begin_write();
+    return {get_values(), size()};
+  }
 
 private:
   const T *get_values() const;
@@ -0,0 +1,32 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @author Simon Heybrock
+#pragma once
+
+#include <tuple>
+#include <vector>
+
+#include "scipp-variable_export.h"
+#include "scipp/variable/variable.h"
+
+namespace scipp::variable {
+
+[[nodiscard]] SCIPP_VARIABLE_EXPORT Variable take(const Variable &var,
+                                                  const Variable &indices,
+                                                  const Dim dim);
+[[nodiscard]] SCIPP_VARIABLE_EXPORT std::vector<Variable>
+take(const std::vector<Variable> &vars, const Variable &indices, const Dim dim);
+
+[[nodiscard]] SCIPP_VARIABLE_EXPORT std::tuple<Variable, Variable>
+take_bin_indices(const Variable &bin_indices, const Variable &indices,
+                 const Dim dim, const Dim buffer_dim);
+
+SCIPP_VARIABLE_EXPORT Variable &put(Variable &out, const Variable &indices,
+                                    const Variable &var, const Dim dim);
+SCIPP_VARIABLE_EXPORT void put(const std::vector<Variable> &outs,
+                               const Variable &indices,
+                               const std::vector<Variable> &vars,
+                               const Dim dim);
+
+} // namespace scipp::variable
@@ -397,8 +397,11 @@ template <class Op> struct Transform {
     auto unit = op.base_op()(variableFactory().elem_unit(*handles.m_var)...);
     auto out = variableFactory().create(dtype<Out>, dims, unit, variances,
                                         *handles.m_var...);
-    do_transform(op, variable_access<Out>(out), std::tuple<>(),
-                 as_view{handles, dims}...);
+    {
+      const ScopedWrite write(out.data());
+      do_transform(op, variable_access<Out>(out), std::tuple<>(),
+                   as_view{handles, dims}...);
+    }
     return out;
   }
 };
@@ -626,6 +629,7 @@ template <bool dry_run> struct in_place {
     op(unit, variableFactory().elem_unit(other)...);
     // Stop early in bad cases of changing units (if `var` is a slice):
     variableFactory().expect_can_set_elem_unit(var, unit);
+    const ScopedWrite write(var.data());
     // Wrapped implementation to convert multiple tuples into a parameter pack.
     transform_data(type_tuples<Ts...>(op), op, name, std::forward<Var>(var),
                    other...);
@@ -91,4 +91,14 @@ transform_subspan(const DType type, const Dim dim, const scipp::index size,
                                           var3);
 }
 
+template <class... Types, class Op>
+[[nodiscard]] Variable
+transform_subspan(const DType type, const Dim dim, const scipp::index size,
+                  const Variable &var1, const Variable &var2,
+                  const Variable &var3, const Variable &var4, Op op,
+                  const std::string_view &name = "operation") {
+  return transform_subspan_impl<Types...>(type, dim, size, op, name, var1, var2,
+                                          var3, var4);
+}
+
 } // namespace scipp::variable
@@ -11,15 +11,30 @@
 #include "scipp/core/dtype.h"
 #include "scipp/units/unit.h"
 
+#include <atomic>
+#include <cstdint>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <optional>
 
 namespace scipp::variable {
 
 class Variable;
 class VariableConcept;
+class PropertyCache;
 
 using VariableConceptHandle = std::shared_ptr<VariableConcept>;
 
+/// Properties of the data of a variable that are cached by VariableConcept.
+enum class CachedProperty {
+  SortedAscending,
+  SortedDescending,
+  Linspace,
+  Min,
+  Max
+};
+
 /// Abstract base class for any data that can be held by Variable. This is using
 /// so-called concept-based polymorphism, see talks by Sean Parent.
 ///
@@ -34,7 +49,9 @@ using VariableConceptHandle = std::shared_ptr<VariableConcept>;
 class SCIPP_VARIABLE_EXPORT VariableConcept {
 public:
   VariableConcept(const units::Unit &unit);
-  virtual ~VariableConcept() = default;
+  VariableConcept(const VariableConcept &other);
+  VariableConcept &operator=(const VariableConcept &other);
+  virtual ~VariableConcept();
 
   virtual VariableConceptHandle clone() const = 0;
   virtual VariableConceptHandle
@@ -46,7 +63,10 @@ public:
   virtual const units::Unit &unit() const { return m_unit; }
   virtual scipp::index size() const = 0;
 
-  virtual void setUnit(const units::Unit &unit) { m_unit = unit; }
+  virtual void setUnit(const units::Unit &unit) {
+    invalidate_cache();
+    m_unit = unit;
+  }
 
   virtual bool hasVariances() const noexcept = 0;
   virtual void setVariances(const Variable &variances) = 0;
@@ -59,10 +79,81 @@ public:
 
   virtual const VariableConceptHandle &bin_indices() const = 0;
 
+  Variable cached(const Variable &var, const CachedProperty property,
+                  const Dim dim,
+                  const std::function<Variable()> &compute) const;
+  /// Drop all cached properties, e.g., when the unit is changed.
+  void invalidate_cache() const noexcept {
+    m_generation.fetch_add(1, std::memory_order_relaxed);
+    if (m_cache_populated.load(std::memory_order_acquire))
+      clear_cache();
+  }
+  /// Drop all cached properties. Must be called when handing out mutable
+  /// access to the data. Unless this happens during a tracked write (see
+  /// ScopedWrite), writes through the returned views may happen at any later
+  /// time and cannot be tracked, so caching is disabled permanently.
+  void begin_write() const noexcept {
+    if (m_tracked_writes.load(std::memory_order_acquire) == 0)
+      m_untracked_write.store(true, std::memory_order_release);
+    invalidate_cache();
+  }
+  /// Begin a write by an operation that does not retain mutable views of the
+  /// data once it is done, such as copy or transform_in_place.
+  virtual void begin_tracked_write() const noexcept {
+    m_tracked_writes.fetch_add(1, std::memory_order_acq_rel);
+    invalidate_cache();
+  }
+  /// End a write started with begin_tracked_write.
+  virtual void end_tracked_write() const noexcept {
+    invalidate_cache();
+    m_tracked_writes.fetch_sub(1, std::memory_order_acq_rel);
+  }
+  /// Return a counter that changes whenever the data may have been modified,
+  /// or nullopt if modifications cannot be tracked, e.g., since mutable views
+  /// have been handed out.
+  std::optional<uint64_t> generation() const noexcept {
+    if (!is_tracked())
+      return std::nullopt;
+    return m_generation.load(std::memory_order_acquire);
+  }
+  virtual void disable_cache();
+
   friend class Variable;
 
 private:
+  void clear_cache() const noexcept;
+  bool is_tracked() const noexcept {
+    return !m_untracked_write.load(std::memory_order_acquire) &&
+           m_tracked_writes.load(std::memory_order_acquire) == 0 &&
+           !m_cache_disabled.load(std::memory_order_relaxed);
+  }
+
   units::Unit m_unit;
+  mutable std::mutex m_cache_mutex;
+  mutable std::atomic<uint64_t> m_generation{0};
+  mutable std::atomic<bool> m_cache_populated{false};
+  mutable std::atomic<bool> m_untracked_write{false};
+  mutable std::atomic<int> m_tracked_writes{0};
+  std::atomic<bool> m_cache_disabled{false};
+  mutable std::unique_ptr<PropertyCache> m_cache;
+};
+
+/// Marks a write to the data of a VariableConcept by an operation that does not
+/// retain mutable views of the data beyond the lifetime of this object.
+///
+/// Mutable access to the data during this time does not disable caching of
+/// properties permanently, see VariableConcept::begin_write.
+class ScopedWrite {
+public:
+  explicit ScopedWrite(const VariableConcept &data) : m_data(data) {
+    m_data.begin_tracked_write();
+  }
+  ScopedWrite(const ScopedWrite &) = delete;
+  ScopedWrite &operator=(const ScopedWrite &) = delete;
+  ~ScopedWrite() { m_data.end_tracked_write(); }
+
+private:
+  const VariableConcept &m_data;
 };
 
 } // namespace scipp::variable
@@ -0,0 +1,137 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @author Simon Heybrock
+#include <algorithm>
+#include <cmath>
+
+#include "scipp/core/except.h"
+#include "scipp/core/tag_util.h"
+#include "scipp/variable/element_array_model.h"
+#include "scipp/variable/linear_range.h"
+
+namespace scipp::variable {
+
+template <class T>
+std::optional<LinearRange<T>> linear_range(const Variable &var) {
+  if (var.dtype() != dtype<T> || var.dims().ndim() > 1)
+    return std::nullopt;
+  const auto &range =
+      static_cast<const ElementArrayModel<T> &>(var.data()).linear_range();
+  if (!range)
+    return std::nullopt;
+  const auto size = var.dims().volume();
+  const auto offset = var.offset();
+  const auto stride = var.dims().ndim() == 0 ? 1 : var.strides()[0];
+  if (size == 0)
+    return LinearRange<T>{range->start, range->step, range->start, 0};
+  if (offset == 0 && stride == 1 && size == range->size)
+    return range;
+  const auto first = (*range)[offset];
+  const auto last = (*range)[offset + (size - 1) * stride];
+  // Interior values of floating-point slices would differ in rounding.
+  if (size <= 2 || std::is_integral_v<T>)
+    return LinearRange<T>{first, static_cast<T>(range->step * stride), last,
+                          size};
+  return std::nullopt;
+}
+
+template SCIPP_VARIABLE_EXPORT std::optional<LinearRange<double>>
+linear_range(const Variable &);
+template SCIPP_VARIABLE_EXPORT std::optional<LinearRange<float>>
+linear_range(const Variable &);
+template SCIPP_VARIABLE_EXPORT std::optional<LinearRange<int64_t>>
+linear_range(const Variable &);
+template SCIPP_VARIABLE_EXPORT std::optional<LinearRange<int32_t>>
+linear_range(const Variable &);
+
+namespace {
+template <class T>
+std::optional<int> linear_range_direction(const Variable &var) {
+  if (const auto range = linear_range<T>(var))
+    return (range->step > T{0}) - (range->step < T{0});
+  return std::nullopt;
+}
+
+template <class T>
+std::optional<Variable> copy_linear_range(const Variable &var) {
+  if (const auto range = linear_range<T>(var))
+    return Variable(var.dims(), std::make_shared<ElementArrayModel<T>>(
+                                    var.unit(), *range));
+  return std::nullopt;
+}
+} // namespace
+
+bool has_linear_range(const Variable &var) {
+  return linear_range_direction(var).has_value();
+}
+
+std::optional<int> linear_range_direction(const Variable &var) {
+  if (const auto direction = linear_range_direction<double>(var))
+    return direction;
+  if (const auto direction = linear_range_direction<float>(var))
+    return direction;
+  if (const auto direction = linear_range_direction<int64_t>(var))
+    return direction;
+  return linear_range_direction<int32_t>(var);
+}
+
+std::optional<Variable> copy_linear_range(const Variable &var) {
+  if (var.hasVariances())
+    return std::nullopt;
+  if (auto out = copy_linear_range<double>(var))
+    return out;
+  if (auto out = copy_linear_range<float>(var))
+    return out;
+  if (auto out = copy_linear_range<int64_t>(var))
+    return out;
+  return copy_linear_range<int32_t>(var);
+}
+
+namespace {
+template <class T> struct MakeArange {
+  static Variable apply(const Dim dim, const Variable &start,
+                        const Variable &stop, const Variable &step) {
+    const auto first = start.value<T>();
+    const auto delta = step.value<T>();
+    if (delta == T{0})
+      throw std::invalid_argument("arange: step must not be zero.");
+    const auto size = std::max(
+        scipp::index(0),
+        static_cast<scipp::index>(std::ceil(
+            (static_cast<double>(stop.value<T>()) - first) / delta)));
+    // Same as numpy.arange, which fills using the difference of the first two
+    // values rather than the step.
+    const auto step_ = static_cast<T>(static_cast<T>(first + delta) - first);
+    const LinearRange<T> range{first, step_,
+                               size == 0 ? first
+                                         : static_cast<T>(first +
+                                                          (size - 1) * step_),
+                               size};
+    return Variable(
+        Dimensions(dim, size),
+        std::make_shared<ElementArrayModel<T>>(start.unit(), range));
+  }
+};
+} // namespace
+
+/// Return a 1-D variable with values in the half-open interval [start, stop)
+/// spaced by `step`, like numpy.arange.
+///
+/// The values are not stored but generated on access, see LinearRange.
+Variable arange(const Dim dim, const Variable &start, const Variable &stop,
+                const Variable &step) {
+  for (const auto &var : {start, stop, step}) {
+    core::expect::equals(Dimensions{}, var.dims());
+    if (var.hasVariances())
+      throw except::VariancesError("arange: arguments cannot have variances.");
+  }
+  core::expect::equals(start.unit(), stop.unit());
+  core::expect::equals(start.unit(), step.unit());
+  core::expect::equals(start.dtype(), stop.dtype());
+  core::expect::equals(start.dtype(), step.dtype());
+  return core::CallDType<double, float, int64_t, int32_t>::apply<MakeArange>(
+      start.dtype(), dim, start, stop, step);
+}
+
+} // namespace scipp::variable
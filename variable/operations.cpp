@@ -6,6 +6,7 @@
 #include "scipp/core/element/special_values.h"
 #include "scipp/core/element/util.h"
 #include "scipp/variable/creation.h"
+#include "scipp/variable/linear_range.h"
 #include "scipp/variable/misc_operations.h"
 #include "scipp/variable/transform.h"
 #include "scipp/variable/variable_concept.h"
@@ -17,7 +18,11 @@ using namespace scipp::core;
 namespace scipp::variable {
 
 /// Return a deep copy of a Variable.
+///
+/// Values given by a linear range are not materialized, see LinearRange.
 Variable copy(const Variable &var) {
+  if (auto out = copy_linear_range(var))
+    return std::move(*out);
   Variable out(empty_like(var));
   out.data().copy(var, out);
   return out;
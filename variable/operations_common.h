@@ -16,6 +16,29 @@ SCIPP_VARIABLE_EXPORT void all_impl(Variable &out, const Variable &var);
 SCIPP_VARIABLE_EXPORT void any_impl(Variable &out, const Variable &var);
 SCIPP_VARIABLE_EXPORT void max_impl(Variable &out, const Variable &var);
 SCIPP_VARIABLE_EXPORT void min_impl(Variable &out, const Variable &var);
+// Masked variants, skipping elements where `mask` is true.
+SCIPP_VARIABLE_EXPORT void sum_impl(Variable &summed, const Variable &var,
+                                    const Variable &mask);
+SCIPP_VARIABLE_EXPORT void all_impl(Variable &out, const Variable &var,
+                                    const Variable &mask);
+SCIPP_VARIABLE_EXPORT void any_impl(Variable &out, const Variable &var,
+                                    const Variable &mask);
+SCIPP_VARIABLE_EXPORT void max_impl(Variable &out, const Variable &var,
+                                    const Variable &mask);
+SCIPP_VARIABLE_EXPORT void min_impl(Variable &out, const Variable &var,
+                                    const Variable &mask);
+SCIPP_VARIABLE_EXPORT Variable masked_sum(const Variable &var, const Dim dim,
+                                          const Variable &mask);
+SCIPP_VARIABLE_EXPORT Variable &masked_sum(const Variable &var, const Dim dim,
+                                           const Variable &mask,
+                                           Variable &out);
+SCIPP_VARIABLE_EXPORT Variable masked_nansum(const Variable &var,
+                                             const Dim dim,
+                                             const Variable &mask);
+SCIPP_VARIABLE_EXPORT Variable &masked_nansum(const Variable &var,
+                                              const Dim dim,
+                                              const Variable &mask,
+                                              Variable &out);
 SCIPP_VARIABLE_EXPORT Variable mean_impl(const Variable &var, const Dim dim,
                                          const Variable &masks_sum);
 SCIPP_VARIABLE_EXPORT Variable &mean_impl(const Variable &var, const Dim dim,
@@ -36,12 +59,16 @@ template <class T> T normalize_impl(const T &nominator, const T &denominator) {
          reciprocal(astype(denominator, type, CopyPolicy::TryAvoid));
 }
 
-SCIPP_VARIABLE_EXPORT void
+SCIPP_VARIABLE_EXPORT bool
 expect_valid_bin_indices(const VariableConceptHandle &indices, const Dim dim,
                          const Sizes &buffer_sizes);
 
 template <class T>
-Variable make_bins_impl(Variable indices, const Dim dim, T &&buffer);
+Variable make_bins_impl(Variable indices, const Dim dim, T &&buffer,
+                        const bool monotonic);
+template <class T>
+Variable make_bins_contiguous(const Variable &indices, const Dim dim,
+                              T &&buffer);
 
 template <class T, class Op> auto reduce_all_dims(const T &obj, const Op &op) {
   if (obj.dims().empty())
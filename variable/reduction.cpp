@@ -7,12 +7,17 @@
 #include "scipp/core/element/arithmetic.h"
 #include "scipp/core/element/comparison.h"
 #include "scipp/core/element/logical.h"
+#include "scipp/core/element/masked_reduction.h"
+#include "scipp/core/parallel.h"
 #include "scipp/variable/accumulate.h"
 #include "scipp/variable/arithmetic.h"
 #include "scipp/variable/astype.h"
+#include "scipp/variable/constant.h"
 #include "scipp/variable/creation.h"
+#include "scipp/variable/linear_range.h"
 #include "scipp/variable/math.h"
 #include "scipp/variable/special_values.h"
+#include "scipp/variable/variable_concept.h"
 
 #include "operations_common.h"
 
@@ -36,6 +41,59 @@ Variable make_accumulant(const Variable &var, const Dim dim,
       var.dims()[dim] == 0 ? Variable(var, dims) : var.slice({dim, 0}), init);
 }
 
+/// Accumulate `var` into `out`, skipping elements where `mask` is true.
+///
+/// `op` and `init` are the unmasked operation and its identity, used for
+/// combining partial results.
+template <class MaskedOp, class Op>
+void masked_reduce_impl(Variable &out, const Variable &var,
+                        const Variable &mask, MaskedOp masked_op, Op op,
+                        const FillValue init, const std::string_view name) {
+  const auto mask_ = broadcast(mask, var.dims());
+  // accumulate_in_place does not use threading for reductions to a scalar with
+  // more than one input, so chunk the input here.
+  const scipp::index min_chunk_volume = 65536;
+  if (out.dims().ndim() != 0 || var.dims().volume() < 2 * min_chunk_volume)
+    return accumulate_in_place(out, var, mask_, masked_op, name);
+  const auto dim = *var.dims().begin();
+  const auto size = var.dims()[dim];
+  const auto nchunk = std::min(scipp::index(24), size);
+  auto partial = special_like(
+      broadcast(out, {Dim::InternalAccumulate, nchunk}), init);
+  const auto reduce = [&](const auto &range) {
+    for (scipp::index i = range.begin(); i < range.end(); ++i) {
+      const Slice slice(dim, size * i / nchunk, size * (i + 1) / nchunk);
+      accumulate_in_place(partial.slice({Dim::InternalAccumulate, i}),
+                          var.slice(slice), mask_.slice(slice), masked_op,
+                          name);
+    }
+  };
+  core::parallel::parallel_for(core::parallel::blocked_range(0, nchunk, 1),
+                               reduce);
+  accumulate_in_place(out, partial, op, name);
+}
+
+/// Reduce `var` along `dim` without inspecting all elements, if `var` has a
+/// constant value.
+///
+/// `reduce` is applied to a single element. For sums (`scale` is true) the
+/// result is multiplied by the length of `dim`.
+template <class Reduce>
+std::optional<Variable> reduce_constant(const Variable &var, const Dim dim,
+                                        Reduce reduce, const bool scale) {
+  if (var.dims().volume() <= 1 || var.hasVariances() ||
+      !has_constant_value(var))
+    return std::nullopt;
+  auto out = reduce(broadcast(first_element(var), Dimensions(dim, 1)), dim);
+  if (scale)
+    out *= astype(var.dims()[dim] * units::one, out.dtype());
+  auto dims = var.dims();
+  dims.erase(dim);
+  if (auto constant = make_constant(dims, out))
+    return constant;
+  return copy(broadcast(out, dims));
+}
+
 } // namespace
 
 void sum_impl(Variable &summed, const Variable &var) {
@@ -46,6 +104,17 @@ void nansum_impl(Variable &summed, const Variable &var) {
   accumulate_in_place(summed, var, element::nan_add_equals, "nansum");
 }
 
+void sum_impl(Variable &summed, const Variable &var, const Variable &mask) {
+  masked_reduce_impl(summed, var, mask, element::masked_add_equals,
+                     element::add_equals, FillValue::ZeroNotBool, "sum");
+}
+
+void nansum_impl(Variable &summed, const Variable &var, const Variable &mask) {
+  masked_reduce_impl(summed, var, mask, element::masked_nan_add_equals,
+                     element::nan_add_equals, FillValue::ZeroNotBool,
+                     "nansum");
+}
+
 template <typename Op>
 Variable sum_with_dim_impl(Op op, const Variable &var, const Dim dim) {
   // Bool DType is a bit special in that it cannot contain its sum.
@@ -75,19 +144,59 @@ Variable &sum_with_dim_inplace_impl(Op op, const Variable &var, const Dim dim,
 }
 
 Variable sum(const Variable &var, const Dim dim) {
-  return sum_with_dim_impl(sum_impl, var, dim);
+  if (auto out = reduce_constant(
+          var, dim, [](auto &&... _) { return sum(_...); }, true))
+    return std::move(*out);
+  return sum_with_dim_impl([](auto &&... _) { sum_impl(_...); }, var, dim);
 }
 
 Variable nansum(const Variable &var, const Dim dim) {
-  return sum_with_dim_impl(nansum_impl, var, dim);
+  if (auto out = reduce_constant(
+          var, dim, [](auto &&... _) { return nansum(_...); }, true))
+    return std::move(*out);
+  return sum_with_dim_impl([](auto &&... _) { nansum_impl(_...); }, var,
+                           dim);
 }
 
 Variable &sum(const Variable &var, const Dim dim, Variable &out) {
-  return sum_with_dim_inplace_impl(sum_impl, var, dim, out);
+  return sum_with_dim_inplace_impl([](auto &&... _) { sum_impl(_...); }, var,
+                                   dim, out);
 }
 
 Variable &nansum(const Variable &var, const Dim dim, Variable &out) {
-  return sum_with_dim_inplace_impl(nansum_impl, var, dim, out);
+  return sum_with_dim_inplace_impl([](auto &&... _) { nansum_impl(_...); },
+                                   var, dim, out);
+}
+
+/// Return the sum along given dimension, ignoring elements where `mask` is
+/// true.
+///
+/// In contrast to summing the result of `where`, this does not require a
+/// temporary copy of the input.
+Variable masked_sum(const Variable &var, const Dim dim, const Variable &mask) {
+  return sum_with_dim_impl(
+      [&mask](auto &out, const auto &v) { sum_impl(out, v, mask); }, var, dim);
+}
+
+Variable &masked_sum(const Variable &var, const Dim dim, const Variable &mask,
+                     Variable &out) {
+  return sum_with_dim_inplace_impl(
+      [&mask](auto &out_, const auto &v) { sum_impl(out_, v, mask); }, var,
+      dim, out);
+}
+
+Variable masked_nansum(const Variable &var, const Dim dim,
+                       const Variable &mask) {
+  return sum_with_dim_impl(
+      [&mask](auto &out, const auto &v) { nansum_impl(out, v, mask); }, var,
+      dim);
+}
+
+Variable &masked_nansum(const Variable &var, const Dim dim,
+                        const Variable &mask, Variable &out) {
+  return sum_with_dim_inplace_impl(
+      [&mask](auto &out_, const auto &v) { nansum_impl(out_, v, mask); }, var,
+      dim, out);
 }
 
 Variable mean_impl(const Variable &var, const Dim dim, const Variable &count) {
@@ -160,6 +269,13 @@ void reduce_impl(Variable &out, const Variable &var, Op op,
 template <class Op>
 Variable reduce_idempotent(const Variable &var, const Dim dim, Op op,
                            const FillValue &init, const std::string_view name) {
+  if (auto out = reduce_constant(
+          var, dim,
+          [&](const Variable &v, const Dim d) {
+            return reduce_idempotent(v, d, op, init, name);
+          },
+          false))
+    return std::move(*out);
   auto out = make_accumulant(var, dim, init);
   reduce_impl(out, var, op, name);
   return out;
@@ -169,6 +285,12 @@ void any_impl(Variable &out, const Variable &var) {
   reduce_impl(out, var, core::element::logical_or_equals, "any");
 }
 
+void any_impl(Variable &out, const Variable &var, const Variable &mask) {
+  masked_reduce_impl(out, var, mask, core::element::masked_logical_or_equals,
+                     core::element::logical_or_equals, FillValue::False,
+                     "any");
+}
+
 Variable any(const Variable &var, const Dim dim) {
   return reduce_idempotent(var, dim, core::element::logical_or_equals,
                            FillValue::False, "any");
@@ -178,6 +300,12 @@ void all_impl(Variable &out, const Variable &var) {
   reduce_impl(out, var, core::element::logical_and_equals, "all");
 }
 
+void all_impl(Variable &out, const Variable &var, const Variable &mask) {
+  masked_reduce_impl(out, var, mask, core::element::masked_logical_and_equals,
+                     core::element::logical_and_equals, FillValue::True,
+                     "all");
+}
+
 Variable all(const Variable &var, const Dim dim) {
   return reduce_idempotent(var, dim, core::element::logical_and_equals,
                            FillValue::True, "all");
@@ -187,6 +315,11 @@ void max_impl(Variable &out, const Variable &var) {
   reduce_impl(out, var, core::element::max_equals, "max");
 }
 
+void max_impl(Variable &out, const Variable &var, const Variable &mask) {
+  masked_reduce_impl(out, var, mask, core::element::masked_max_equals,
+                     core::element::max_equals, FillValue::Lowest, "max");
+}
+
 /// Return the maximum along given dimension.
 ///
 /// Variances are not considered when determining the maximum. If present, the
@@ -209,6 +342,11 @@ void min_impl(Variable &out, const Variable &var) {
   reduce_impl(out, var, core::element::min_equals, "min");
 }
 
+void min_impl(Variable &out, const Variable &var, const Variable &mask) {
+  masked_reduce_impl(out, var, mask, core::element::masked_min_equals,
+                     core::element::min_equals, FillValue::Max, "min");
+}
+
 /// Return the minimum along given dimension.
 ///
 /// Variances are not considered when determining the minimum. If present, the
@@ -237,9 +375,29 @@ Variable nansum(const Variable &var) {
   return reduce_all_dims(var, [](auto &&... _) { return nansum(_...); });
 }
 
+namespace {
+/// Return the maximum (`direction` 1) or minimum (`direction` -1) of 1-D `var`
+/// if its values are given by a linear range, without inspecting the values.
+std::optional<Variable> linear_range_extremum(const Variable &var,
+                                              const int direction) {
+  if (var.dims().ndim() != 1 || var.dims().volume() == 0)
+    return std::nullopt;
+  const auto sign = linear_range_direction(var);
+  if (!sign || var.hasVariances())
+    return std::nullopt;
+  const auto dim = var.dims().inner();
+  return copy(var.slice(
+      {dim, *sign == direction ? var.dims()[dim] - 1 : scipp::index(0)}));
+}
+} // namespace
+
 /// Return the maximum along all dimensions.
 Variable max(const Variable &var) {
-  return reduce_all_dims(var, [](auto &&... _) { return max(_...); });
+  if (auto out = linear_range_extremum(var, 1))
+    return std::move(*out);
+  return var.data().cached(var, CachedProperty::Max, Dim::Invalid, [&]() {
+    return reduce_all_dims(var, [](auto &&... _) { return max(_...); });
+  });
 }
 
 /// Return the maximum along all dimensions ignorning NaN values.
@@ -249,7 +407,11 @@ Variable nanmax(const Variable &var) {
 
 /// Return the minimum along all dimensions.
 Variable min(const Variable &var) {
-  return reduce_all_dims(var, [](auto &&... _) { return min(_...); });
+  if (auto out = linear_range_extremum(var, -1))
+    return std::move(*out);
+  return var.data().cached(var, CachedProperty::Min, Dim::Invalid, [&]() {
+    return reduce_all_dims(var, [](auto &&... _) { return min(_...); });
+  });
 }
 
 /// Return the minimum along all dimensions ignoring NaN values.
@@ -3,9 +3,11 @@
 /// @file
 /// @author Owen Arnold, Simon Heybrock
 #include <algorithm>
+#include <utility>
 
 #include "scipp/units/dim.h"
 #include "scipp/variable/comparison.h"
+#include "scipp/variable/linear_range.h"
 #include "scipp/variable/reduction.h"
 #include "scipp/variable/slice.h"
 #include "scipp/variable/string.h"
@@ -16,8 +18,74 @@ namespace scipp::variable {
 
 namespace {
 
+/// Return the number of elements of `range` satisfying `pred`.
+///
+/// Since the range is monotonic the matching elements form a prefix or suffix,
+/// which is found by binary search without accessing any values.
+template <class T, class Pred>
+scipp::index count_matching(const LinearRange<T> &range, const T value,
+                            const Pred &pred) {
+  const bool prefix = range.size > 0 && pred(range[0], value);
+  scipp::index begin = 0;
+  scipp::index end = range.size;
+  while (begin < end) {
+    const auto mid = begin + (end - begin) / 2;
+    if (pred(range[mid], value) == prefix)
+      begin = mid + 1;
+    else
+      end = mid;
+  }
+  return prefix ? begin : range.size - begin;
+}
+
+template <class T, class Func>
+auto visit_linear_range(const Variable &coord, const Variable &value,
+                        const Func &func) {
+  using Result = decltype(func(std::declval<LinearRange<double>>(), 0.0));
+  if (value.dtype() != dtype<T>)
+    return Result{};
+  if (const auto range = linear_range<T>(coord))
+    return func(*range, value.value<T>());
+  return Result{};
+}
+
+/// Return `func(range, value)`, where `range` is the linear range of `coord`,
+/// if the values of `coord` are given by a linear range. `func` must return an
+/// optional, an empty optional is returned otherwise.
+template <class Func>
+auto visit_linear_range(const Variable &coord, const Variable &value,
+                        const Func &func) {
+  using Result = decltype(func(std::declval<LinearRange<double>>(), 0.0));
+  if (coord.unit() != value.unit() || value.hasVariances())
+    return Result{};
+  if (auto result = visit_linear_range<double>(coord, value, func))
+    return result;
+  if (auto result = visit_linear_range<float>(coord, value, func))
+    return result;
+  if (auto result = visit_linear_range<int64_t>(coord, value, func))
+    return result;
+  return visit_linear_range<int32_t>(coord, value, func);
+}
+
+constexpr auto is_less = [](const auto &a, const auto &b) { return a < b; };
+constexpr auto is_less_equal = [](const auto &a, const auto &b) {
+  return a <= b;
+};
+constexpr auto is_greater = [](const auto &a, const auto &b) { return a > b; };
+constexpr auto is_greater_equal = [](const auto &a, const auto &b) {
+  return a >= b;
+};
+
 scipp::index get_count(const Variable &coord, const Dim dim,
                        const Variable &value, const bool ascending) {
+  if (const auto count = visit_linear_range(
+          coord, value,
+          [ascending](const auto &range, const auto v) {
+            return std::optional{
+                ascending ? count_matching(range, v, is_less_equal)
+                          : count_matching(range, v, is_greater_equal)};
+          }))
+    return *count;
   return (ascending ? sum(less_equal(coord, value), dim)
                     : sum(greater_equal(coord, value), dim))
       .value<scipp::index>();
@@ -48,6 +116,37 @@ auto get_coord(const Variable &coord, const Dim dim) {
   return std::tuple(coord, ascending);
 }
 
+[[noreturn]] void throw_no_unique_point(const Dim dim, const Variable &value) {
+  throw except::SliceError("Coord " + to_string(dim) +
+                           " does not contain unique point with value " +
+                           to_string(value) + '\n');
+}
+
+/// Return the index of `value` in `coord` if the values of `coord` are given by
+/// a linear range.
+std::optional<scipp::index> find_point(const Variable &coord, const Dim dim,
+                                       const Variable &value) {
+  const auto bounds = visit_linear_range(
+      coord, value,
+      [](const auto &range,
+         const auto v) -> std::optional<std::pair<scipp::index, scipp::index>> {
+        using T = std::decay_t<decltype(v)>;
+        if (range.step == T{0})
+          return std::nullopt;
+        if (range.step > T{0})
+          return std::pair{count_matching(range, v, is_less),
+                           count_matching(range, v, is_less_equal)};
+        return std::pair{count_matching(range, v, is_greater),
+                         count_matching(range, v, is_greater_equal)};
+      });
+  if (!bounds)
+    return std::nullopt;
+  const auto [begin, end] = *bounds;
+  if (end - begin != 1)
+    throw_no_unique_point(dim, value);
+  return begin;
+}
+
 } // namespace
 
 std::tuple<Dim, scipp::index> get_slice_params(const Sizes &dims,
@@ -59,11 +158,11 @@ std::tuple<Dim, scipp::index> get_slice_params(const Sizes &dims,
     const auto &[coord, ascending] = get_coord(coord_, dim);
     return std::tuple{dim, get_count(coord, dim, value, ascending) - 1};
   } else {
-    auto eq = equal(get_1d_coord(coord_), value);
+    if (const auto index = find_point(get_1d_coord(coord_), dim, value))
+      return {dim, *index};
+    auto eq = equal(coord_, value);
     if (sum(eq, dim).template value<scipp::index>() != 1)
-      throw except::SliceError("Coord " + to_string(dim) +
-                               " does not contain unique point with value " +
-                               to_string(value) + '\n');
+      throw_no_unique_point(dim, value);
     auto values = eq.template values<bool>();
     auto it = std::find(values.begin(), values.end(), true);
     return {dim, std::distance(values.begin(), it)};
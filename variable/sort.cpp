@@ -2,7 +2,10 @@
 // Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
 /// @file
 /// @author Thibault Chatel
+#include "scipp/core/argsort.h"
 #include "scipp/core/element/sort.h"
+#include "scipp/core/except.h"
+#include "scipp/core/tag_util.h"
 #include "scipp/variable/sort.h"
 #include "scipp/variable/subspan_view.h"
 #include "scipp/variable/transform.h"
@@ -11,6 +14,15 @@ using namespace scipp::core;
 
 namespace scipp::variable {
 
+namespace {
+template <class T> struct Argsort {
+  static auto apply(const Variable &key, const SortOrder order) {
+    const auto contiguous = key.strides()[0] == 1 ? key : copy(key);
+    return core::argsort(contiguous.values<T>().as_span(), order);
+  }
+};
+} // namespace
+
 Variable sort(const Variable &var, const Dim dim, const SortOrder order) {
   auto out = copy(var);
   if (order == SortOrder::Ascending)
@@ -22,4 +34,20 @@ Variable sort(const Variable &var, const Dim dim, const SortOrder order) {
   return out;
 }
 
+/// Return indices that stably sort a 1-D `key` in given order.
+///
+/// NaN values are placed at the end when sorting in ascending order and at the
+/// beginning when sorting in descending order.
+Variable argsort(const Variable &key, const SortOrder order) {
+  if (key.dims().ndim() != 1)
+    throw except::DimensionError("Sort key must be 1-dimensional.");
+  if (key.hasVariances())
+    throw except::VariancesError("Sort key cannot have variances.");
+  auto indices = core::CallDType<double, float, int64_t, int32_t, bool,
+                                 std::string, core::time_point>::
+      apply<Argsort>(key.dtype(), key, order);
+  return makeVariable<scipp::index>(key.dims(), units::one,
+                                    Values(std::move(indices)));
+}
+
 } // namespace scipp::variable
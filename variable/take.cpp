@@ -0,0 +1,317 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @author Simon Heybrock
+#include <algorithm>
+#include <functional>
+#include <numeric>
+
+#include "scipp/core/eigen.h"
+#include "scipp/core/except.h"
+#include "scipp/core/parallel.h"
+#include "scipp/core/tag_util.h"
+#include "scipp/core/time_point.h"
+#include "scipp/variable/arithmetic.h"
+#include "scipp/variable/bins.h"
+#include "scipp/variable/creation.h"
+#include "scipp/variable/cumulative.h"
+#include "scipp/variable/take.h"
+#include "scipp/variable/util.h"
+#include "scipp/variable/variable_concept.h"
+#include "scipp/variable/variable_factory.h"
+
+namespace scipp::variable {
+
+namespace {
+
+/// Copy of the blocks of a single array for a gather or scatter.
+///
+/// The copy is split into `nparts` parts and each call handles one part. All
+/// arrays of a batch are processed part by part, such that the corresponding
+/// chunk of the index array is reused from cache.
+using CopyBlocks = std::function<void(scipp::index part, scipp::index nparts)>;
+
+/// Indices per part, chosen such that a chunk of indices fits into L2 cache.
+constexpr scipp::index part_size = 1 << 14;
+
+/// Return a copy of blocks of `inner` elements.
+///
+/// For a gather, block `i` of every outer slice of `dst` is set to block
+/// `indices[i]` of the same slice of `src`. A scatter is the inverse, with
+/// roles of `src` and `dst` exchanged. `extent` is the extent of the indexed
+/// dimension.
+template <class T>
+CopyBlocks copy_blocks(const scipp::span<const T> src,
+                       const scipp::span<T> dst,
+                       const scipp::span<const scipp::index> indices,
+                       const bool scatter, const scipp::index outer,
+                       const scipp::index extent, const scipp::index inner) {
+  return [=](const scipp::index part, const scipp::index nparts) {
+    const auto size = scipp::size(indices);
+    const auto n = outer * size;
+    const auto end = (part + 1) * n / nparts;
+    for (auto i = part * n / nparts; i < end; ++i) {
+      const auto indexed = ((i / size) * extent + indices[i % size]) * inner;
+      const auto sequential = i * inner;
+      const auto from = src.begin() + (scatter ? sequential : indexed);
+      std::copy(from, from + inner,
+                dst.begin() + (scatter ? indexed : sequential));
+    }
+  };
+}
+
+template <class T> struct MakeCopyBlocks {
+  static void apply(std::vector<CopyBlocks> &batch, const Variable &src,
+                    Variable &dst, const Dim dim,
+                    const scipp::span<const scipp::index> indices,
+                    const bool scatter) {
+    const auto &dims = scatter ? dst.dims() : src.dims();
+    scipp::index outer = 1;
+    scipp::index inner = 1;
+    for (scipp::index i = 0; i < dims.ndim(); ++i) {
+      if (i < dims.index(dim))
+        outer *= dims.size(i);
+      if (i > dims.index(dim))
+        inner *= dims.size(i);
+    }
+    batch.push_back(copy_blocks(src.values<T>().as_span(),
+                                dst.values<T>().as_span(), indices, scatter,
+                                outer, dims[dim], inner));
+    if (src.hasVariances())
+      batch.push_back(copy_blocks(src.variances<T>().as_span(),
+                                  dst.variances<T>().as_span(), indices,
+                                  scatter, outer, dims[dim], inner));
+  }
+};
+
+template <class... Ts> struct CopyBlocksDTypes : core::CallDType<Ts...> {
+  static bool contains(const DType type) noexcept {
+    return ((type == dtype<Ts>) || ...);
+  }
+};
+
+using copy_blocks_dtypes =
+    CopyBlocksDTypes<double, float, int64_t, int32_t, bool, core::time_point,
+                     std::string, Eigen::Vector3d, Eigen::Matrix3d>;
+
+bool is_contiguous(const Variable &var) {
+  return Strides(var.strides()) == Strides(var.dims());
+}
+
+void run(const std::vector<CopyBlocks> &batch, const scipp::index work) {
+  const auto nparts = std::max(scipp::index(1), work / part_size);
+  core::parallel::parallel_for(
+      core::parallel::blocked_range(0, nparts, 1), [&](const auto &range) {
+        for (scipp::index part = range.begin(); part != range.end(); ++part)
+          for (const auto &copy : batch)
+            copy(part, nparts);
+      });
+}
+
+/// Copy runs of consecutive indices as slices, for dtypes without `CopyBlocks`.
+void copy_runs(const Variable &src, Variable &dst, const Dim dim,
+               const scipp::span<const scipp::index> indices,
+               const bool scatter) {
+  std::vector<scipp::index> runs;
+  for (scipp::index i = 0; i < scipp::size(indices); ++i)
+    if (i == 0 || indices[i] != indices[i - 1] + 1)
+      runs.push_back(i);
+  runs.push_back(scipp::size(indices));
+  core::parallel::parallel_for(
+      core::parallel::blocked_range(0, scipp::size(runs) - 1),
+      [&](const auto &range) {
+        for (scipp::index run = range.begin(); run != range.end(); ++run) {
+          const auto begin = runs[run];
+          const auto end = runs[run + 1];
+          const Slice sequential(dim, begin, end);
+          const Slice indexed(dim, indices[begin],
+                              indices[begin] + (end - begin));
+          auto dst_slice = dst.slice(scatter ? indexed : sequential);
+          dst.data().copy(src.slice(scatter ? sequential : indexed), dst_slice);
+        }
+      });
+}
+
+/// Copy slices between `srcs` and `dsts` according to `indices`.
+///
+/// All arrays supported by `CopyBlocks` are handled in a single pass over the
+/// indices, all others fall back to copying slices.
+void copy_indexed(const std::vector<Variable> &srcs,
+                  const std::vector<Variable> &dsts, const Dim dim,
+                  const scipp::span<const scipp::index> indices,
+                  const bool scatter) {
+  std::vector<CopyBlocks> batch;
+  std::vector<Variable> contiguous;
+  scipp::index work = 0;
+  for (size_t i = 0; i < srcs.size(); ++i) {
+    auto dst = dsts[i];
+    if (!is_bins(srcs[i]) && copy_blocks_dtypes::contains(srcs[i].dtype()) &&
+        is_contiguous(dst)) {
+      const auto &src = contiguous.emplace_back(
+          is_contiguous(srcs[i]) ? srcs[i] : copy(srcs[i]));
+      copy_blocks_dtypes::apply<MakeCopyBlocks>(src.dtype(), batch, src, dst,
+                                                dim, indices, scatter);
+      work = std::max(work, (scatter ? src : dst).dims().volume());
+    } else {
+      copy_runs(srcs[i], dst, dim, indices, scatter);
+    }
+  }
+  run(batch, work);
+}
+
+/// Return contiguous copy of `indices` after checking that they are valid.
+Variable checked_indices(const Variable &indices, const Dim dim,
+                         const scipp::index extent, const bool unique) {
+  if (indices.dims().ndim() != 1)
+    throw except::DimensionError("Indices must be 1-dimensional.");
+  auto contiguous = indices.strides()[0] == 1 ? indices : copy(indices);
+  const auto values = contiguous.values<scipp::index>().as_span();
+  if (std::any_of(values.begin(), values.end(), [extent](const auto i) {
+        return i < 0 || i >= extent;
+      }))
+    throw except::SliceError("Index out of range along dimension " +
+                             to_string(dim) + " of extent " +
+                             std::to_string(extent) + ".");
+  if (unique) {
+    std::vector<bool> seen(extent);
+    for (const auto i : values) {
+      if (seen[i])
+        throw except::SliceError("Duplicate index " + std::to_string(i) +
+                                 " in put along dimension " + to_string(dim) +
+                                 ".");
+      seen[i] = true;
+    }
+  }
+  return contiguous;
+}
+
+void expect_contains(const Variable &var, const Dim dim) {
+  if (!var.dims().contains(dim))
+    throw except::DimensionError("Variable does not depend on dimension " +
+                                 to_string(dim) + ".");
+}
+
+} // namespace
+
+/// Return slices of `var` along `dim` given by `indices`, in order.
+///
+/// This is the equivalent of `numpy.take`. Indices may be repeated or omitted.
+Variable take(const Variable &var, const Variable &indices, const Dim dim) {
+  return take(std::vector{var}, indices, dim).front();
+}
+
+/// Return slices of each of `vars` along `dim` given by `indices`, in order.
+///
+/// All variables are processed in a single pass over the indices.
+std::vector<Variable> take(const std::vector<Variable> &vars,
+                           const Variable &indices, const Dim dim) {
+  if (vars.empty())
+    return {};
+  for (const auto &var : vars)
+    expect_contains(var, dim);
+  const auto extent = vars.front().dims()[dim];
+  for (const auto &var : vars)
+    if (var.dims()[dim] != extent)
+      throw except::DimensionError("Extent along " + to_string(dim) +
+                                   " of variables passed to take differs.");
+  const auto contiguous = checked_indices(indices, dim, extent, false);
+  const auto idx = contiguous.values<scipp::index>().as_span();
+  std::vector<Variable> in;
+  std::vector<Variable> in_out;
+  std::vector<Variable> out;
+  for (const auto &var : vars) {
+    if (var.dtype() == dtype<bucket<Variable>>) {
+      // Gather events instead of copying bin by bin.
+      const auto [bin_indices, buffer_dim, buffer] =
+          var.constituents<Variable>();
+      auto [out_indices, buffer_indices] =
+          take_bin_indices(bin_indices, indices, dim, buffer_dim);
+      out.emplace_back(make_bins_no_validate(
+          std::move(out_indices), buffer_dim,
+          take(buffer, buffer_indices, buffer_dim)));
+      continue;
+    }
+    if (is_bins(var)) {
+      const auto [begin, end] = unzip(var.bin_indices());
+      out.emplace_back(empty_like(var, {}, take(end - begin, indices, dim)));
+    } else {
+      auto dims = var.dims();
+      dims.resize(dim, scipp::size(idx));
+      out.emplace_back(empty_like(var, dims));
+    }
+    in.emplace_back(var);
+    in_out.emplace_back(out.back());
+  }
+  copy_indexed(in, in_out, dim, idx, false);
+  return out;
+}
+
+/// Return bin indices and buffer indices for taking bins of binned data.
+///
+/// The first returned variable holds the indices of the bins of the result,
+/// referring to a contiguous buffer. The second holds the indices of the
+/// elements of the input buffer to take along `buffer_dim` for this buffer.
+std::tuple<Variable, Variable> take_bin_indices(const Variable &bin_indices,
+                                                const Variable &indices,
+                                                const Dim dim,
+                                                const Dim buffer_dim) {
+  const auto [begin0, end0] = unzip(bin_indices);
+  const auto taken = take(std::vector{begin0, end0}, indices, dim);
+  const auto sizes = taken[1] - taken[0];
+  const auto end = cumsum(sizes);
+  const auto begin = end - sizes;
+  const auto in_begin = taken[0].values<scipp::index>().as_span();
+  const auto out_begin = begin.values<scipp::index>().as_span();
+  const auto out_end = end.values<scipp::index>().as_span();
+  const auto size = out_end.empty() ? 0 : out_end.back();
+  auto buffer_indices =
+      makeVariable<scipp::index>(Dims{buffer_dim}, Shape{size});
+  const auto values = buffer_indices.values<scipp::index>().as_span();
+  core::parallel::parallel_for(
+      core::parallel::blocked_range(0, scipp::size(in_begin)),
+      [&](const auto &range) {
+        for (scipp::index i = range.begin(); i != range.end(); ++i)
+          std::iota(values.begin() + out_begin[i], values.begin() + out_end[i],
+                    in_begin[i]);
+      });
+  return {zip(begin, end), std::move(buffer_indices)};
+}
+
+/// Set slices of `out` along `dim` given by `indices` to slices of `var`.
+///
+/// This is the equivalent of `numpy.put`, the inverse of `take`. Slice `i` of
+/// `var` is written to slice `indices[i]` of `out`. Indices must be unique.
+Variable &put(Variable &out, const Variable &indices, const Variable &var,
+              const Dim dim) {
+  put(std::vector{out}, indices, std::vector{var}, dim);
+  return out;
+}
+
+/// Set slices of each of `outs` along `dim` given by `indices` to slices of the
+/// corresponding item of `vars`.
+///
+/// All variables are processed in a single pass over the indices.
+void put(const std::vector<Variable> &outs, const Variable &indices,
+         const std::vector<Variable> &vars, const Dim dim) {
+  if (outs.size() != vars.size())
+    throw std::invalid_argument("Number of outputs and inputs for put differ.");
+  if (outs.empty())
+    return;
+  const auto extent = outs.front().dims()[dim];
+  const auto contiguous = checked_indices(indices, dim, extent, true);
+  const auto idx = contiguous.values<scipp::index>().as_span();
+  for (size_t i = 0; i < outs.size(); ++i) {
+    expect_contains(outs[i], dim);
+    expect_contains(vars[i], dim);
+    if (outs[i].dims()[dim] != extent)
+      throw except::DimensionError("Extent along " + to_string(dim) +
+                                   " of outputs passed to put differs.");
+    auto dims = outs[i].dims();
+    dims.resize(dim, scipp::size(idx));
+    core::expect::equals(vars[i].dims(), dims);
+    outs[i].validateSlice(Slice(dim, 0, scipp::size(idx)), vars[i]);
+  }
+  copy_indexed(vars, outs, dim, idx, true);
+}
+
+} // namespace scipp::variable
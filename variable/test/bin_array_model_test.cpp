@@ -45,6 +45,61 @@ TEST_F(BucketModelTest, construct_empty_range) {
   EXPECT_NO_THROW(Model(empty, Dim::X, buffer));
 }
 
+TEST_F(BucketModelTest, construct_monotonic) {
+  const auto var = make_bins(indices, Dim::X, buffer);
+  EXPECT_TRUE(dynamic_cast<const Model &>(var.data()).indices_monotonic());
+}
+
+TEST_F(BucketModelTest, monotonic_discarded_on_write_to_indices) {
+  auto var = make_bins(indices, Dim::X, buffer);
+  var.bin_indices().values<index_pair>()[1] = {3, 4};
+  EXPECT_FALSE(dynamic_cast<const Model &>(var.data()).indices_monotonic());
+  EXPECT_FALSE(has_validated_bin_indices(var));
+}
+
+TEST_F(BucketModelTest, monotonic_discarded_on_copy_to_shared_indices) {
+  const auto var = make_bins(indices, Dim::X, buffer);
+  ASSERT_TRUE(has_validated_bin_indices(var));
+  // `indices` shares its data with the model, so this write is detected only
+  // by the change of the generation of the indices.
+  copy(make_indices({{0, 2}, {3, 4}}), indices);
+  EXPECT_EQ(var.bin_indices(), indices);
+  EXPECT_FALSE(has_validated_bin_indices(var));
+}
+
+TEST_F(BucketModelTest, monotonic_discarded_on_mutable_indices) {
+  auto var = make_bins(indices, Dim::X, buffer);
+  EXPECT_TRUE(has_validated_bin_indices(var));
+  static_cast<void>(dynamic_cast<Model &>(var.data()).indices());
+  EXPECT_FALSE(has_validated_bin_indices(var));
+}
+
+TEST_F(BucketModelTest, monotonic_discarded_on_mutable_buffer) {
+  auto var = make_bins(indices, Dim::X, buffer);
+  static_cast<void>(dynamic_cast<Model &>(var.data()).buffer());
+  EXPECT_FALSE(has_validated_bin_indices(var));
+}
+
+TEST_F(BucketModelTest, validated_bin_indices) {
+  const auto var = make_bins(indices, Dim::X, buffer);
+  EXPECT_TRUE(has_validated_bin_indices(var));
+  EXPECT_TRUE(has_validated_bin_indices(var.slice({Dim::Y, 1, 2})));
+  EXPECT_FALSE(has_validated_bin_indices(
+      make_bins_no_validate(indices, Dim::X, buffer)));
+  EXPECT_FALSE(has_validated_bin_indices(buffer));
+}
+
+TEST_F(BucketModelTest, construct_unordered) {
+  const auto var = make_bins(make_indices({{2, 4}, {0, 2}}), Dim::X, buffer);
+  EXPECT_FALSE(dynamic_cast<const Model &>(var.data()).indices_monotonic());
+}
+
+TEST_F(BucketModelTest, construct_unordered_overlapping_fail) {
+  auto overlapping = make_indices({{1, 4}, {0, 2}});
+  EXPECT_THROW_DISCARD(make_bins(overlapping, Dim::X, buffer),
+                       except::SliceError);
+}
+
 TEST_F(BucketModelTest, construct_negative_range_fail) {
   auto overlapping = make_indices({{0, 2}, {2, 1}});
   EXPECT_THROW_DISCARD(make_bins(overlapping, Dim::X, buffer),
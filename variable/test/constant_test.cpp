@@ -0,0 +1,113 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+#include <gtest/gtest.h>
+
+#include "scipp/core/parallel.h"
+#include "scipp/variable/arithmetic.h"
+#include "scipp/variable/comparison.h"
+#include "scipp/variable/constant.h"
+#include "scipp/variable/creation.h"
+#include "scipp/variable/reduction.h"
+#include "scipp/variable/shape.h"
+
+using namespace scipp;
+using namespace scipp::variable;
+
+class ConstantTest : public ::testing::Test {
+protected:
+  Dimensions dims{{Dim::X, Dim::Y}, {4, 2}};
+  Variable var = *make_constant(dims, makeVariable<int32_t>(Values{3}));
+  Variable dense = makeVariable<int32_t>(dims, Values{3, 3, 3, 3, 3, 3, 3, 3});
+};
+
+TEST_F(ConstantTest, make_constant) {
+  EXPECT_EQ(constant_value<int32_t>(var), 3);
+  EXPECT_EQ(var, dense);
+  EXPECT_TRUE(has_constant_value(var.slice({Dim::X, 1, 3})));
+  EXPECT_FALSE(has_constant_value(dense));
+}
+
+TEST_F(ConstantTest, make_constant_with_variances_fails) {
+  const auto scalar = makeVariable<double>(Values{1.0}, Variances{2.0});
+  EXPECT_FALSE(make_constant(dims, scalar));
+}
+
+TEST_F(ConstantTest, copies_are_not_constant) {
+  EXPECT_FALSE(has_constant_value(copy(var)));
+  EXPECT_EQ(copy(var), dense);
+  const auto scalar = makeVariable<int32_t>(Values{3});
+  EXPECT_FALSE(has_constant_value(copy(broadcast(scalar, dims))));
+  EXPECT_FALSE(has_constant_value(ones(dims, units::m, dtype<double>)));
+}
+
+TEST_F(ConstantTest, special_like) {
+  EXPECT_EQ(constant_value<bool>(special_like(dense, FillValue::False)),
+            false);
+  EXPECT_EQ(constant_value<int32_t>(special_like(dense, FillValue::Max)),
+            std::numeric_limits<int32_t>::max());
+  const auto resized = resize(dense, Dim::X, 3, FillValue::ZeroNotBool);
+  EXPECT_EQ(constant_value<int32_t>(resized), 0);
+  EXPECT_EQ(resized.dims(), Dimensions({Dim::X, Dim::Y}, {3, 2}));
+  const auto with_variances =
+      makeVariable<double>(dims, Values{1, 2, 3, 4, 5, 6, 7, 8},
+                           Variances{1, 2, 3, 4, 5, 6, 7, 8});
+  EXPECT_FALSE(has_constant_value(
+      special_like(with_variances, FillValue::ZeroNotBool)));
+}
+
+TEST_F(ConstantTest, write_materializes) {
+  const auto original = copy(var);
+  var.values<int32_t>()[1] = 2;
+  EXPECT_FALSE(has_constant_value(var));
+  EXPECT_EQ(var.values<int32_t>()[0], 3);
+  EXPECT_EQ(var.values<int32_t>()[1], 2);
+  EXPECT_TRUE(has_constant_value(original));
+  EXPECT_EQ(original, dense);
+}
+
+TEST_F(ConstantTest, concurrent_writes_to_slices) {
+  core::parallel::parallel_for(
+      core::parallel::blocked_range(0, 4, 1), [&](const auto &range) {
+        for (auto i = range.begin(); i != range.end(); ++i) {
+          auto slice = var.slice({Dim::X, i});
+          slice += 1 * units::one;
+        }
+      });
+  EXPECT_FALSE(has_constant_value(var));
+  EXPECT_EQ(var, dense + 1 * units::one);
+}
+
+TEST_F(ConstantTest, transform) {
+  EXPECT_FALSE(has_constant_value(var + var));
+  EXPECT_EQ(var + var, dense + dense);
+  EXPECT_EQ(less(var, 4 * units::one), less(dense, 4 * units::one));
+  EXPECT_EQ(var * (2.5 * units::one), dense * (2.5 * units::one));
+  EXPECT_EQ(var + dense, dense + dense);
+}
+
+TEST_F(ConstantTest, sum) {
+  const auto summed = sum(var, Dim::X);
+  EXPECT_TRUE(has_constant_value(summed));
+  EXPECT_EQ(summed, sum(dense, Dim::X));
+  EXPECT_EQ(sum(var), sum(dense));
+  EXPECT_EQ(mean(var, Dim::Y), mean(dense, Dim::Y));
+  const auto flags = special_like(dense, FillValue::True);
+  EXPECT_EQ(sum(flags, Dim::X),
+            makeVariable<int64_t>(Dims{Dim::Y}, Shape{2}, Values{4, 4}));
+}
+
+TEST_F(ConstantTest, idempotent_reductions) {
+  EXPECT_TRUE(has_constant_value(max(var, Dim::X)));
+  EXPECT_EQ(max(var, Dim::X), max(dense, Dim::X));
+  EXPECT_EQ(min(var, Dim::Y), min(dense, Dim::Y));
+  EXPECT_EQ(max(var), max(dense));
+  const auto flags = special_like(dense, FillValue::False);
+  EXPECT_EQ(any(flags, Dim::X),
+            makeVariable<bool>(Dims{Dim::Y}, Shape{2}, Values{false, false}));
+}
+
+TEST_F(ConstantTest, empty) {
+  const auto empty =
+      *make_constant({Dim::X, 0}, makeVariable<double>(Values{1.0}));
+  EXPECT_EQ(sum(empty, Dim::X), makeVariable<double>(Values{0.0}));
+}
@@ -0,0 +1,140 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+#include <gtest/gtest.h>
+
+#include "scipp/core/except.h"
+#include "scipp/variable/linear_range.h"
+#include "scipp/variable/reduction.h"
+#include "scipp/variable/slice.h"
+#include "scipp/variable/util.h"
+
+#include "test_macros.h"
+
+using namespace scipp;
+using namespace scipp::variable;
+
+TEST(LinearRangeTest, arange_int) {
+  const auto var = arange(Dim::X, 2 * units::m, 11 * units::m, 3 * units::m);
+  EXPECT_TRUE(has_linear_range(var));
+  EXPECT_EQ(var, makeVariable<int32_t>(Dims{Dim::X}, Shape{3}, units::m,
+                                       Values{2, 5, 8}));
+}
+
+TEST(LinearRangeTest, arange_negative_step) {
+  const auto var = arange(Dim::X, 5 * units::one, 0 * units::one,
+                          -2 * units::one);
+  EXPECT_EQ(var,
+            makeVariable<int32_t>(Dims{Dim::X}, Shape{3}, Values{5, 3, 1}));
+}
+
+TEST(LinearRangeTest, arange_empty) {
+  const auto var = arange(Dim::X, 5 * units::one, 0 * units::one,
+                          1 * units::one);
+  EXPECT_EQ(var.dims(), Dimensions(Dim::X, 0));
+}
+
+TEST(LinearRangeTest, arange_double_matches_numpy) {
+  const auto var = arange(Dim::X, 0.0 * units::s, 1.0 * units::s,
+                          0.1 * units::s);
+  ASSERT_EQ(var.dims(), Dimensions(Dim::X, 10));
+  for (scipp::index i = 0; i < 10; ++i)
+    EXPECT_EQ(var.values<double>()[i], 0.0 + i * 0.1);
+}
+
+TEST(LinearRangeTest, arange_bad_args) {
+  EXPECT_THROW_DISCARD(
+      arange(Dim::X, 0 * units::one, 2 * units::one, 0 * units::one),
+      std::invalid_argument);
+  EXPECT_THROW_DISCARD(
+      arange(Dim::X, 0 * units::one, 2 * units::m, 1 * units::one),
+      except::UnitError);
+  EXPECT_THROW_DISCARD(
+      arange(Dim::X, 0.0 * units::one, 2 * units::one, 1 * units::one),
+      except::TypeError);
+  EXPECT_THROW_DISCARD(arange(Dim::X, 0 * units::one,
+                              makeVariable<int32_t>(Dims{Dim::Y}, Shape{1}),
+                              1 * units::one),
+                       except::DimensionError);
+}
+
+TEST(LinearRangeTest, read_keeps_range) {
+  const auto var = arange(Dim::X, 0 * units::one, 4 * units::one,
+                          1 * units::one);
+  EXPECT_EQ(var.values<int32_t>()[3], 3);
+  EXPECT_TRUE(has_linear_range(var));
+}
+
+TEST(LinearRangeTest, write_drops_range) {
+  auto var = arange(Dim::X, 0 * units::one, 4 * units::one, 1 * units::one);
+  var.values<int32_t>()[3] = 1;
+  EXPECT_FALSE(has_linear_range(var));
+  EXPECT_EQ(var, makeVariable<int32_t>(Dims{Dim::X}, Shape{4},
+                                       Values{0, 1, 2, 1}));
+  EXPECT_FALSE(issorted(var, Dim::X, SortOrder::Ascending));
+  EXPECT_EQ(max(var), 2 * units::one);
+}
+
+TEST(LinearRangeTest, copy_keeps_range) {
+  const auto var = arange(Dim::X, 0.0 * units::one, 2.0 * units::one,
+                          0.25 * units::one);
+  const auto copied = copy(var);
+  EXPECT_TRUE(has_linear_range(copied));
+  EXPECT_EQ(copied, var);
+}
+
+TEST(LinearRangeTest, slice) {
+  const auto ints =
+      arange(Dim::X, 0 * units::one, 10 * units::one, 1 * units::one);
+  const auto slice = ints.slice({Dim::X, 2, 8});
+  const auto range = linear_range<int32_t>(slice);
+  ASSERT_TRUE(range);
+  EXPECT_EQ(range->start, 2);
+  EXPECT_EQ(range->last, 7);
+  EXPECT_EQ(range->size, 6);
+  EXPECT_EQ(copy(slice), makeVariable<int32_t>(Dims{Dim::X}, Shape{6},
+                                               Values{2, 3, 4, 5, 6, 7}));
+  // Interior values of floating-point slices may differ in rounding.
+  const auto doubles =
+      arange(Dim::X, 0.0 * units::one, 1.0 * units::one, 0.1 * units::one);
+  EXPECT_FALSE(has_linear_range(doubles.slice({Dim::X, 1, 5})));
+  EXPECT_TRUE(has_linear_range(doubles.slice({Dim::X, 1, 3})));
+}
+
+TEST(LinearRangeTest, properties) {
+  const auto var =
+      arange(Dim::X, 9 * units::one, -1 * units::one, -2 * units::one);
+  EXPECT_FALSE(issorted(var, Dim::X, SortOrder::Ascending));
+  EXPECT_TRUE(issorted(var, Dim::X, SortOrder::Descending));
+  EXPECT_FALSE(islinspace(var, Dim::X).value<bool>());
+  EXPECT_EQ(min(var), 1 * units::one);
+  EXPECT_EQ(max(var), 9 * units::one);
+  const auto ascending =
+      arange(Dim::X, 0.0 * units::m, 1.0 * units::m, 0.5 * units::m);
+  EXPECT_TRUE(islinspace(ascending, Dim::X).value<bool>());
+  EXPECT_EQ(min(ascending), 0.0 * units::m);
+  EXPECT_EQ(max(ascending), 0.5 * units::m);
+}
+
+TEST(LinearRangeTest, get_slice_params_point) {
+  const auto coord =
+      arange(Dim::X, 2 * units::m, 11 * units::m, 3 * units::m);
+  const auto &sizes = coord.dims();
+  EXPECT_EQ(get_slice_params(sizes, coord, 8 * units::m),
+            std::tuple(Dim::X, scipp::index(2)));
+  EXPECT_THROW_DISCARD(get_slice_params(sizes, coord, 7 * units::m),
+                       except::SliceError);
+  const auto descending =
+      arange(Dim::X, 8 * units::m, -1 * units::m, -3 * units::m);
+  EXPECT_EQ(get_slice_params(sizes, descending, 2 * units::m),
+            std::tuple(Dim::X, scipp::index(2)));
+}
+
+TEST(LinearRangeTest, get_slice_params_range) {
+  const auto edges =
+      arange(Dim::X, 0.0 * units::m, 5.0 * units::m, 1.0 * units::m);
+  const Dimensions sizes(Dim::X, 4);
+  EXPECT_EQ(get_slice_params(sizes, edges, 1.5 * units::m, 3.0 * units::m),
+            std::tuple(Dim::X, scipp::index(1), scipp::index(3)));
+  EXPECT_EQ(get_slice_params(sizes, edges, 1.5 * units::m),
+            std::tuple(Dim::X, scipp::index(1)));
+}
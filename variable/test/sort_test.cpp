@@ -2,6 +2,9 @@
 // Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
 #include <gtest/gtest.h>
 
+#include "test_macros.h"
+
+#include "scipp/core/except.h"
 #include "scipp/variable/sort.h"
 #include "scipp/variable/util.h"
 #include "scipp/variable/variable.h"
@@ -44,3 +47,44 @@ TEST_F(SortTest, descending_with_variances) {
             makeVariable<double>(dims, Values{3.0, 2.0, 1.0, 5.0, 4.0, 0.0},
                                  Variances{2.0, 3.0, 1.0, 1.0, 3.0, 2.0}));
 }
+
+TEST(ArgsortTest, ascending) {
+  const auto key =
+      makeVariable<double>(Dims{Dim::X}, Shape{4}, Values{3.0, 1.0, 2.0, 1.0});
+  EXPECT_EQ(argsort(key), makeVariable<scipp::index>(
+                              Dims{Dim::X}, Shape{4}, Values{1, 3, 2, 0}));
+}
+
+TEST(ArgsortTest, descending_is_stable) {
+  const auto key =
+      makeVariable<int64_t>(Dims{Dim::X}, Shape{4}, Values{1, 3, 1, 2});
+  EXPECT_EQ(argsort(key, SortOrder::Descending),
+            makeVariable<scipp::index>(Dims{Dim::X}, Shape{4},
+                                       Values{1, 3, 0, 2}));
+}
+
+TEST(ArgsortTest, strings) {
+  const auto key = makeVariable<std::string>(Dims{Dim::X}, Shape{3},
+                                             Values{"b", "c", "a"});
+  EXPECT_EQ(argsort(key), makeVariable<scipp::index>(Dims{Dim::X}, Shape{3},
+                                                     Values{2, 0, 1}));
+}
+
+TEST(ArgsortTest, slice) {
+  const auto key = makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{2, 2},
+                                        Values{2.0, 1.0, 4.0, 3.0});
+  EXPECT_EQ(argsort(key.slice({Dim::X, 0})),
+            makeVariable<scipp::index>(Dims{Dim::Y}, Shape{2}, Values{0, 1}));
+  EXPECT_EQ(argsort(key.slice({Dim::Y, 1})),
+            makeVariable<scipp::index>(Dims{Dim::X}, Shape{2}, Values{1, 0}));
+}
+
+TEST(ArgsortTest, bad_key) {
+  const auto key = makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{2, 2},
+                                        Values{2.0, 1.0, 4.0, 3.0});
+  EXPECT_THROW_DISCARD(argsort(key), except::DimensionError);
+  EXPECT_THROW_DISCARD(argsort(makeVariable<double>(Dims{Dim::X}, Shape{1},
+                                                    Values{1.0},
+                                                    Variances{1.0})),
+                       except::VariancesError);
+}
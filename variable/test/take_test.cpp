@@ -0,0 +1,152 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+#include <gtest/gtest.h>
+
+#include "test_macros.h"
+
+#include "scipp/core/except.h"
+#include "scipp/variable/bins.h"
+#include "scipp/variable/shape.h"
+#include "scipp/variable/take.h"
+#include "scipp/variable/util.h"
+
+using namespace scipp;
+using namespace scipp::variable;
+
+class TakeTest : public ::testing::Test {
+protected:
+  Variable var = makeVariable<double>(
+      Dims{Dim::Y, Dim::X}, Shape{2, 3}, units::m, Values{1, 2, 3, 4, 5, 6},
+      Variances{7, 8, 9, 10, 11, 12});
+  Variable indices =
+      makeVariable<scipp::index>(Dims{Dim::X}, Shape{4}, Values{2, 0, 0, 1});
+};
+
+TEST_F(TakeTest, inner) {
+  EXPECT_EQ(take(var, indices, Dim::X),
+            makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{2, 4}, units::m,
+                                 Values{3, 1, 1, 2, 6, 4, 4, 5},
+                                 Variances{9, 7, 7, 8, 12, 10, 10, 11}));
+}
+
+TEST_F(TakeTest, outer) {
+  const auto rows =
+      makeVariable<scipp::index>(Dims{Dim::Y}, Shape{3}, Values{1, 1, 0});
+  EXPECT_EQ(take(var, rows, Dim::Y),
+            makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{3, 3}, units::m,
+                                 Values{4, 5, 6, 4, 5, 6, 1, 2, 3},
+                                 Variances{10, 11, 12, 10, 11, 12, 7, 8, 9}));
+}
+
+TEST_F(TakeTest, transposed) {
+  EXPECT_EQ(take(transpose(var), indices, Dim::X),
+            transpose(take(var, indices, Dim::X)));
+}
+
+TEST_F(TakeTest, empty) {
+  const auto none = makeVariable<scipp::index>(Dims{Dim::X}, Shape{0});
+  EXPECT_EQ(take(var, none, Dim::X).dims(),
+            (Dimensions{{Dim::Y, Dim::X}, {2, 0}}));
+}
+
+TEST_F(TakeTest, strings) {
+  const auto strings = makeVariable<std::string>(Dims{Dim::X}, Shape{3},
+                                                 Values{"a", "b", "c"});
+  EXPECT_EQ(take(strings, indices, Dim::X),
+            makeVariable<std::string>(Dims{Dim::X}, Shape{4},
+                                      Values{"c", "a", "a", "b"}));
+}
+
+TEST_F(TakeTest, binned) {
+  const auto buffer =
+      makeVariable<double>(Dims{Dim::Event}, Shape{5}, Values{1, 2, 3, 4, 5});
+  const auto bin_indices = makeVariable<scipp::index_pair>(
+      Dims{Dim::X}, Shape{3},
+      Values{std::pair{0, 2}, std::pair{2, 2}, std::pair{2, 5}});
+  const auto binned = make_bins(bin_indices, Dim::Event, buffer);
+  const auto expected = make_bins(
+      makeVariable<scipp::index_pair>(
+          Dims{Dim::X}, Shape{4},
+          Values{std::pair{0, 3}, std::pair{3, 5}, std::pair{5, 7},
+                 std::pair{7, 7}}),
+      Dim::Event,
+      makeVariable<double>(Dims{Dim::Event}, Shape{7},
+                           Values{3, 4, 5, 1, 2, 1, 2}));
+  EXPECT_EQ(take(binned, indices, Dim::X), expected);
+}
+
+TEST_F(TakeTest, bad_indices) {
+  EXPECT_THROW_DISCARD(
+      take(var,
+           makeVariable<scipp::index>(Dims{Dim::X}, Shape{1}, Values{3}),
+           Dim::X),
+      except::SliceError);
+  EXPECT_THROW_DISCARD(
+      take(var,
+           makeVariable<scipp::index>(Dims{Dim::X}, Shape{1}, Values{-1}),
+           Dim::X),
+      except::SliceError);
+  EXPECT_THROW_DISCARD(take(var, indices, Dim::Z), except::DimensionError);
+}
+
+TEST_F(TakeTest, batch) {
+  const auto other = makeVariable<std::string>(Dims{Dim::X}, Shape{3},
+                                               Values{"a", "b", "c"});
+  const auto taken = take(std::vector{var, other}, indices, Dim::X);
+  ASSERT_EQ(taken.size(), 2);
+  EXPECT_EQ(taken[0], take(var, indices, Dim::X));
+  EXPECT_EQ(taken[1], take(other, indices, Dim::X));
+}
+
+TEST_F(TakeTest, batch_extent_mismatch) {
+  EXPECT_THROW_DISCARD(
+      take(std::vector{var, var.slice({Dim::X, 0, 2})}, indices, Dim::X),
+      except::DimensionError);
+}
+
+TEST_F(TakeTest, put) {
+  auto out = makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{2, 4}, units::m,
+                                  Values{0, 0, 0, 0, 0, 0, 0, 0},
+                                  Variances{0, 0, 0, 0, 0, 0, 0, 0});
+  const auto targets =
+      makeVariable<scipp::index>(Dims{Dim::X}, Shape{3}, Values{3, 0, 1});
+  put(out, targets, var, Dim::X);
+  EXPECT_EQ(out, makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{2, 4},
+                                      units::m, Values{2, 3, 0, 1, 5, 6, 0, 4},
+                                      Variances{8, 9, 0, 7, 11, 12, 0, 10}));
+}
+
+TEST_F(TakeTest, put_inverts_take) {
+  const auto permutation =
+      makeVariable<scipp::index>(Dims{Dim::X}, Shape{3}, Values{2, 0, 1});
+  auto out = copy(var);
+  put(out, permutation, take(var, permutation, Dim::X), Dim::X);
+  EXPECT_EQ(out, var);
+}
+
+TEST_F(TakeTest, put_strings) {
+  auto out = makeVariable<std::string>(Dims{Dim::X}, Shape{3},
+                                       Values{"a", "b", "c"});
+  put(out, makeVariable<scipp::index>(Dims{Dim::X}, Shape{1}, Values{1}),
+      makeVariable<std::string>(Dims{Dim::X}, Shape{1}, Values{"x"}), Dim::X);
+  EXPECT_EQ(out, makeVariable<std::string>(Dims{Dim::X}, Shape{3},
+                                           Values{"a", "x", "c"}));
+}
+
+TEST_F(TakeTest, put_bad_arguments) {
+  auto out = copy(var);
+  EXPECT_THROW_DISCARD(
+      put(out,
+          makeVariable<scipp::index>(Dims{Dim::X}, Shape{3}, Values{0, 1, 1}),
+          var, Dim::X),
+      except::SliceError);
+  EXPECT_THROW_DISCARD(
+      put(out,
+          makeVariable<scipp::index>(Dims{Dim::X}, Shape{3}, Values{2, 0, 1}),
+          var.slice({Dim::X, 0, 2}), Dim::X),
+      except::DimensionError);
+  EXPECT_THROW_DISCARD(put(out, indices.slice({Dim::X, 0, 1}),
+                           values(var.slice({Dim::X, 0, 1})), Dim::X),
+                       except::VariancesError);
+  EXPECT_EQ(out, var);
+}
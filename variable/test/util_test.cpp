@@ -4,7 +4,9 @@
 
 #include "scipp/core/except.h"
 #include "scipp/variable/arithmetic.h"
+#include "scipp/variable/reduction.h"
 #include "scipp/variable/util.h"
+#include "scipp/variable/variable_concept.h"
 
 #include "test_macros.h"
 
@@ -95,3 +97,84 @@ TEST(VariableTest, where) {
       makeVariable<double>(Dims{Dim::X}, Shape{3}, units::m, Values{1, 4, 3});
   EXPECT_EQ(where(mask, var, var + var), expected_var);
 }
+
+TEST(CachedPropertyTest, issorted_invalidated_by_write) {
+  auto var = makeVariable<double>(Dims{Dim::X}, Shape{3}, Values{1, 2, 3});
+  EXPECT_TRUE(issorted(var, Dim::X));
+  EXPECT_FALSE(issorted(var, Dim::X, SortOrder::Descending));
+  var.values<double>()[0] = 4;
+  EXPECT_FALSE(issorted(var, Dim::X));
+  var.values<double>()[0] = 0;
+  EXPECT_TRUE(issorted(var, Dim::X));
+}
+
+TEST(CachedPropertyTest, issorted_not_cached_while_view_is_held) {
+  auto var = makeVariable<double>(Dims{Dim::X}, Shape{3}, Values{1, 2, 3});
+  auto values = var.values<double>();
+  EXPECT_TRUE(issorted(var, Dim::X));
+  values[0] = 4;
+  EXPECT_FALSE(issorted(var, Dim::X));
+  // Tracked writes do not resume caching while the view may still be written.
+  values[0] = 1;
+  var += 1.0 * units::one;
+  EXPECT_TRUE(issorted(var, Dim::X));
+  values[0] = 4;
+  EXPECT_FALSE(issorted(var, Dim::X));
+}
+
+TEST(CachedPropertyTest, issorted_invalidated_by_write_to_slice) {
+  auto var = makeVariable<double>(Dims{Dim::X}, Shape{3}, Values{1, 2, 3});
+  const auto shared = var;
+  EXPECT_TRUE(issorted(shared, Dim::X));
+  var.slice({Dim::X, 1}).value<double>() = 5;
+  EXPECT_FALSE(issorted(shared, Dim::X));
+}
+
+TEST(CachedPropertyTest, issorted_invalidated_by_copy) {
+  auto var = makeVariable<double>(Dims{Dim::X}, Shape{3}, Values{1, 2, 3});
+  EXPECT_TRUE(issorted(var, Dim::X));
+  copy(makeVariable<double>(Dims{Dim::X}, Shape{3}, Values{3, 2, 1}), var);
+  EXPECT_FALSE(issorted(var, Dim::X));
+}
+
+TEST(CachedPropertyTest, slices_are_cached_separately) {
+  const auto var =
+      makeVariable<double>(Dims{Dim::X}, Shape{4}, Values{1, 2, 0, 3});
+  EXPECT_TRUE(issorted(var.slice({Dim::X, 0, 2}), Dim::X));
+  EXPECT_FALSE(issorted(var, Dim::X));
+  EXPECT_TRUE(issorted(var.slice({Dim::X, 2, 4}), Dim::X));
+  EXPECT_FALSE(issorted(var.slice({Dim::X, 1, 3}), Dim::X));
+}
+
+TEST(CachedPropertyTest, islinspace_invalidated_by_write) {
+  auto var = makeVariable<double>(Dims{Dim::X}, Shape{3}, Values{1, 2, 3});
+  EXPECT_EQ(islinspace(var, Dim::X), makeVariable<bool>(Values{true}));
+  var.values<double>()[2] = 4;
+  EXPECT_EQ(islinspace(var, Dim::X), makeVariable<bool>(Values{false}));
+}
+
+TEST(CachedPropertyTest, min_max_invalidated_by_set_unit) {
+  auto var =
+      makeVariable<double>(Dims{Dim::X}, Shape{3}, units::m, Values{1, 3, 2});
+  EXPECT_EQ(min(var), 1.0 * units::m);
+  EXPECT_EQ(max(var), 3.0 * units::m);
+  var.setUnit(units::s);
+  EXPECT_EQ(min(var), 1.0 * units::s);
+  EXPECT_EQ(max(var), 3.0 * units::s);
+}
+
+TEST(CachedPropertyTest, result_is_copy) {
+  const auto var = makeVariable<double>(Dims{Dim::X}, Shape{2}, Values{1, 2});
+  auto result = min(var);
+  result.value<double>() = 10;
+  EXPECT_EQ(min(var), 1.0 * units::one);
+}
+
+TEST(CachedPropertyTest, disabled) {
+  auto var = makeVariable<double>(Dims{Dim::X}, Shape{2}, Values{1, 2});
+  auto *data = var.values<double>().data();
+  var.data_handle()->disable_cache();
+  EXPECT_TRUE(issorted(var, Dim::X));
+  data[0] = 3;
+  EXPECT_FALSE(issorted(var, Dim::X));
+}
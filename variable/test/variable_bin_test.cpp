@@ -2,6 +2,7 @@
 // Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
 #include <gtest/gtest.h>
 
+#include "scipp/variable/bin_array_model.h"
 #include "scipp/variable/bins.h"
 #include "scipp/variable/operations.h"
 
@@ -57,6 +58,23 @@ TEST_F(VariableBinsTest, copy) {
   EXPECT_NE(copied, var); // buffer gets copied
 }
 
+TEST_F(VariableBinsTest, copy_stores_contiguous_indices_as_offsets) {
+  using Model = variable::BinArrayModel<Variable>;
+  const auto copied = copy(var);
+  const auto &model = dynamic_cast<const Model &>(copied.data());
+  ASSERT_TRUE(model.offsets().is_valid());
+  EXPECT_EQ(model.offsets(), makeVariable<scipp::index>(
+                                 Dims{Dim::X}, Shape{3}, Values{0, 2, 4}));
+  // Operations use offsets directly, without converting to index pairs.
+  const auto scale = makeVariable<double>(Values{2});
+  EXPECT_EQ(copied.slice({Dim::Y, 1}) * scale, var.slice({Dim::Y, 1}) * scale);
+  EXPECT_TRUE(model.offsets().is_valid());
+  // Converted on access.
+  EXPECT_EQ(copied.bin_indices(), indices);
+  EXPECT_FALSE(model.offsets().is_valid());
+  EXPECT_EQ(copied, var);
+}
+
 TEST_F(VariableBinsTest, assign) {
   Variable copy = variable::copy(var);
   var.values<bucket<Variable>>()[0] += var.values<bucket<Variable>>()[1];
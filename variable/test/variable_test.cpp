@@ -196,6 +196,29 @@ TEST(Variable, copy_slice) {
   EXPECT_EQ(parent, d);
 }
 
+TEST(Variable, copy_strided_and_transposed) {
+  const auto parent = makeVariable<double>(
+      Dims{Dim::X, Dim::Y}, Shape{3, 4}, units::m,
+      Values{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12},
+      Variances{13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24});
+  const auto slice = parent.slice({Dim::Y, 1, 3});
+  auto out = makeVariable<double>(Dims{Dim::X, Dim::Y}, Shape{3, 2},
+                                  Values{}, Variances{});
+  copy(slice, out);
+  EXPECT_EQ(out, slice);
+  out = makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{2, 3}, Values{},
+                             Variances{});
+  copy(slice, out);
+  EXPECT_EQ(out, slice.transpose({Dim::Y, Dim::X}));
+}
+
+TEST(Variable, copy_overlapping_slices) {
+  auto var = makeVariable<int64_t>(Dims{Dim::X}, Shape{4}, Values{1, 2, 3, 4});
+  copy(var.slice({Dim::X, 0, 3}), var.slice({Dim::X, 1, 4}));
+  EXPECT_EQ(var,
+            makeVariable<int64_t>(Dims{Dim::X}, Shape{4}, Values{1, 1, 2, 3}));
+}
+
 TEST(Variable, copy_slice_unit_checks) {
   const auto parent =
       makeVariable<double>(Dims(), Shape(), units::m, Values{1});
@@ -8,8 +8,10 @@
 #include "scipp/variable/accumulate.h"
 #include "scipp/variable/arithmetic.h"
 #include "scipp/variable/astype.h"
+#include "scipp/variable/linear_range.h"
 #include "scipp/variable/subspan_view.h"
 #include "scipp/variable/transform.h"
+#include "scipp/variable/variable_concept.h"
 
 using namespace scipp::core;
 
@@ -42,29 +44,55 @@ Variable linspace(const Variable &start, const Variable &stop, const Dim dim,
   return out;
 }
 
+/// Return true for every subspan of `var` along `dim` with linearly spaced
+/// values.
+///
+/// The result is cached, see VariableConcept::cached. Values given by a
+/// LinearRange are not inspected.
 Variable islinspace(const Variable &var, const Dim dim) {
-  return transform(subspan_view(var, dim), core::element::islinspace,
-                   "islinspace");
+  if (var.dims().ndim() == 1)
+    if (const auto direction = linear_range_direction(var))
+      return makeVariable<bool>(Values{var.dims()[dim] > 1 && *direction > 0});
+  return var.data().cached(var, CachedProperty::Linspace, dim, [&]() {
+    return transform(subspan_view(var, dim), core::element::islinspace,
+                     "islinspace");
+  });
 }
 
 /// Return true if variable values are sorted along given dim.
 ///
 /// If `order` is SortOrder::Ascending, checks if values are non-decreasing.
 /// If `order` is SortOrder::Descending, checks if values are non-increasing.
+/// The result is cached, see VariableConcept::cached. Values given by a
+/// LinearRange are not inspected.
 bool issorted(const Variable &x, const Dim dim, const SortOrder order) {
   const auto size = x.dims()[dim];
   if (size < 2)
     return true;
-  auto out = makeVariable<bool>(Values{true});
-  if (order == SortOrder::Ascending)
-    accumulate_in_place(out, x.slice({dim, 0, size - 1}),
-                        x.slice({dim, 1, size}),
-                        core::element::issorted_nondescending, "issorted");
-  else
-    accumulate_in_place(out, x.slice({dim, 0, size - 1}),
-                        x.slice({dim, 1, size}),
-                        core::element::issorted_nonascending, "issorted");
-  return out.value<bool>();
+  if (x.dims().ndim() == 1)
+    if (const auto direction = linear_range_direction(x))
+      return order == SortOrder::Ascending ? *direction >= 0
+                                           : *direction <= 0;
+  const auto property = order == SortOrder::Ascending
+                            ? CachedProperty::SortedAscending
+                            : CachedProperty::SortedDescending;
+  return x.data()
+      .cached(x, property, dim,
+              [&]() {
+                auto out = makeVariable<bool>(Values{true});
+                if (order == SortOrder::Ascending)
+                  accumulate_in_place(out, x.slice({dim, 0, size - 1}),
+                                      x.slice({dim, 1, size}),
+                                      core::element::issorted_nondescending,
+                                      "issorted");
+                else
+                  accumulate_in_place(out, x.slice({dim, 0, size - 1}),
+                                      x.slice({dim, 1, size}),
+                                      core::element::issorted_nonascending,
+                                      "issorted");
+                return out;
+              })
+      .value<bool>();
 }
 
 /// Zip elements of two variables into a variable where each element is a pair.
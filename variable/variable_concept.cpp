@@ -1,8 +1,122 @@
+#include <utility>
+#include <vector>
+
 #include "scipp/variable/variable_concept.h"
 #include "scipp/core/dimensions.h"
+#include "scipp/core/strides.h"
+#include "scipp/variable/variable.h"
 
 namespace scipp::variable {
 
+/// Cached properties of (views into) the data of a VariableConcept.
+///
+/// Properties depend on the view, so entries are keyed by offset, dims, and
+/// strides of the variable used for computing them, in addition to the property
+/// and dimension. The number of entries is limited since each distinct slice
+/// adds an entry.
+class PropertyCache {
+public:
+  struct Key {
+    CachedProperty property;
+    Dim dim;
+    scipp::index offset;
+    Dimensions dims;
+    Strides strides;
+    bool operator==(const Key &other) const {
+      return property == other.property && dim == other.dim &&
+             offset == other.offset && dims == other.dims &&
+             strides == other.strides;
+    }
+  };
+
+  const Variable *find(const Key &key) const {
+    for (const auto &[k, value] : m_entries)
+      if (k == key)
+        return &value;
+    return nullptr;
+  }
+
+  void insert(Key key, Variable value) {
+    if (m_entries.size() == max_entries)
+      m_entries.erase(m_entries.begin());
+    m_entries.emplace_back(std::move(key), std::move(value));
+  }
+
+private:
+  static constexpr size_t max_entries = 16;
+  std::vector<std::pair<Key, Variable>> m_entries;
+};
+
 VariableConcept::VariableConcept(const units::Unit &unit) : m_unit(unit) {}
 
+VariableConcept::VariableConcept(const VariableConcept &other)
+    : m_unit(other.m_unit) {}
+
+VariableConcept &VariableConcept::operator=(const VariableConcept &other) {
+  invalidate_cache();
+  m_unit = other.m_unit;
+  return *this;
+}
+
+VariableConcept::~VariableConcept() = default;
+
+namespace {
+bool is_cacheable(const DType dtype) {
+  return dtype == core::dtype<double> || dtype == core::dtype<float> ||
+         dtype == core::dtype<int64_t> || dtype == core::dtype<int32_t> ||
+         dtype == core::dtype<core::time_point>;
+}
+} // namespace
+
+/// Return the cached `property` of `var` along `dim`, calling `compute` if it
+/// is not cached.
+///
+/// `var` must be a view into this concept. The cache is cleared on write access
+/// to the data, i.e., when obtaining non-const views of values or variances,
+/// and when the unit or variances are set. Since writes through non-const views
+/// may happen at any later time, results are never cached after such a view
+/// has been handed out, unless this happened during a tracked write (see
+/// ScopedWrite), and not while a tracked write is in progress. Only data of
+/// simple numeric dtypes is cached. A copy of the cached result is returned.
+Variable
+VariableConcept::cached(const Variable &var, const CachedProperty property,
+                        const Dim dim,
+                        const std::function<Variable()> &compute) const {
+  if (!is_tracked() || !is_cacheable(dtype()))
+    return compute();
+  PropertyCache::Key key{property, dim, var.offset(), var.dims(),
+                         Strides(var.strides())};
+  {
+    std::lock_guard lock(m_cache_mutex);
+    if (m_cache)
+      if (const auto *value = m_cache->find(key))
+        return variable::copy(*value);
+  }
+  // Writes while computing the property invalidate the result.
+  const auto generation = m_generation.load(std::memory_order_acquire);
+  auto value = compute();
+  std::lock_guard lock(m_cache_mutex);
+  if (generation == m_generation.load(std::memory_order_acquire) &&
+      is_tracked()) {
+    if (!m_cache)
+      m_cache = std::make_unique<PropertyCache>();
+    m_cache->insert(std::move(key), variable::copy(value));
+    m_cache_populated.store(true, std::memory_order_release);
+  }
+  return value;
+}
+
+/// Disable caching of properties, e.g., since the data may be modified in
+/// ways that cannot be tracked, such as through a buffer exposed to Python.
+void VariableConcept::disable_cache() {
+  m_cache_disabled.store(true, std::memory_order_relaxed);
+  invalidate_cache();
+}
+
+void VariableConcept::clear_cache() const noexcept {
+  std::lock_guard lock(m_cache_mutex);
+  m_cache.reset();
+  m_cache_populated.store(false, std::memory_order_release);
+}
+
 } // namespace scipp::variable
@@ -2,6 +2,9 @@
 // Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
 /// @file
 /// @author Simon Heybrock
+#include <atomic>
+
+#include "scipp/core/parallel.h"
 #include "scipp/variable/bin_array_variable.tcc"
 #include "scipp/variable/bins.h"
 
@@ -19,8 +22,8 @@ private:
                           const bool variances) const override {
     // Buffer contains only variable, which is created with new dtype, no
     // information to copy from parent.
-    return make_bins(copy(indices), dim,
-                     variableFactory().create(type, dims, unit, variances));
+    return make_bins_contiguous(
+        indices, dim, variableFactory().create(type, dims, unit, variances));
   }
   const Variable &data(const Variable &var) const override {
     return this->buffer(var);
@@ -28,11 +31,44 @@ private:
   Variable data(Variable &var) const override { return this->buffer(var); }
 };
 
-void expect_valid_bin_indices(const VariableConceptHandle &indices,
+namespace {
+/// Return true if bins are in order, non-overlapping, and within bounds.
+///
+/// This is the common case, e.g., for the output of `bin`, and can be checked
+/// in parallel without copying or sorting the indices. If this returns false
+/// the indices may nevertheless be valid.
+bool is_monotonic(const scipp::span<const scipp::index_pair> &vals,
+                  const scipp::index size) {
+  const auto nbin = scipp::size(vals);
+  std::atomic<bool> ok{true};
+  core::parallel::parallel_for(
+      core::parallel::blocked_range(0, nbin), [&](const auto &range) {
+        for (scipp::index i = range.begin(); i < range.end(); ++i) {
+          const auto [begin, end] = vals[i];
+          if (begin < 0 || begin > end || end > size ||
+              (i + 1 < nbin && end > vals[i + 1].first)) {
+            ok = false;
+            return;
+          }
+        }
+      });
+  return ok;
+}
+} // namespace
+
+/// Throw if bin indices are out of range or overlapping.
+///
+/// Returns true if the indices are monotonic, i.e., bins are stored in the
+/// buffer in the same order as the indices in memory.
+bool expect_valid_bin_indices(const VariableConceptHandle &indices,
                               const Dim dim, const Sizes &buffer_sizes) {
-  auto copy = requireT<const ElementArrayModel<scipp::index_pair>>(*indices);
-  const auto vals = copy.values();
-  std::sort(vals.begin(), vals.end());
+  const auto &model =
+      requireT<const ElementArrayModel<scipp::index_pair>>(*indices);
+  if (is_monotonic(model.values(), buffer_sizes[dim]))
+    return true;
+  std::vector<scipp::index_pair> vals(model.values().begin(),
+                                      model.values().end());
+  core::parallel::parallel_sort(vals.begin(), vals.end());
   if ((!vals.empty() && (vals.begin()->first < 0)) ||
       (!vals.empty() && ((vals.end() - 1)->second > buffer_sizes[dim])))
     throw except::SliceError("Bin indices out of range");
@@ -46,6 +82,7 @@ void expect_valid_bin_indices(const VariableConceptHandle &indices,
       }) != vals.end())
     throw except::SliceError(
         "Bin begin index must be less or equal to its end index.");
+  return false;
 }
 
 namespace {